@@ -0,0 +1,185 @@
+// Performance benchmarks for the c2k sockets library.
+//
+// Each benchmark prints one or more CSV records of the form
+//
+//     benchmark,parameter,metric,value,unit
+//
+// to stdout, so that results can be collected and compared across releases by
+// machine. Progress information goes to stderr.
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <numeric>
+#include <sockets/sockets.hpp>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+using namespace c2k;
+
+using Clock = std::chrono::steady_clock;
+
+static constexpr auto localhost = "127.0.0.1";
+
+static void print_record(
+        std::string const& benchmark,
+        std::string const& parameter,
+        std::string const& metric,
+        double const value,
+        std::string const& unit
+) {
+    std::cout << benchmark << ',' << parameter << ',' << metric << ',' << value << ',' << unit << '\n';
+}
+
+[[nodiscard]] static std::vector<std::byte> make_payload(std::size_t const size) {
+    auto payload = std::vector<std::byte>{};
+    payload.reserve(size);
+    for (auto i = std::size_t{ 0 }; i < size; ++i) {
+        payload.push_back(static_cast<std::byte>(i));
+    }
+    return payload;
+}
+
+[[nodiscard]] static double percentile(std::vector<double> const& sorted_values, double const fraction) {
+    auto const index = static_cast<std::size_t>(fraction * static_cast<double>(sorted_values.size() - 1));
+    return sorted_values.at(index);
+}
+
+// measures how fast data can be pushed through an echoing connection, per message size
+static void echo_throughput() {
+    static constexpr auto total_bytes_per_size = std::size_t{ 32 * 1024 * 1024 };
+
+    auto const server = Sockets::create_server(AddressFamily::Ipv4, 0, [](ClientSocket client) {
+        while (client.is_connected()) {
+            auto received = client.receive(1 << 20).get();
+            if (received.empty()) {
+                break;
+            }
+            std::ignore = client.send(std::move(received));
+        }
+    });
+
+    for (auto const message_size : { 64, 512, 4096, 65536 }) {
+        auto client = Sockets::create_client(AddressFamily::Ipv4, localhost, server.local_address().port);
+        auto const payload = make_payload(static_cast<std::size_t>(message_size));
+        auto const num_messages = total_bytes_per_size / payload.size();
+
+        auto const start = Clock::now();
+        for (auto i = std::size_t{ 0 }; i < num_messages; ++i) {
+            std::ignore = client.send(std::span{ payload });
+            auto num_bytes_echoed = std::size_t{ 0 };
+            while (num_bytes_echoed < payload.size()) {
+                num_bytes_echoed += client.receive_exact(payload.size() - num_bytes_echoed).get().size();
+            }
+        }
+        auto const seconds = std::chrono::duration<double>{ Clock::now() - start }.count();
+
+        auto const megabytes = static_cast<double>(num_messages * payload.size()) / (1024.0 * 1024.0);
+        print_record("echo_throughput", std::to_string(message_size), "throughput", megabytes / seconds, "MiB/s");
+        std::cerr << "echo_throughput(" << message_size << ") done\n";
+    }
+}
+
+// measures the round-trip latency distribution of a small message over loopback
+static void round_trip_latency() {
+    static constexpr auto num_round_trips = std::size_t{ 20000 };
+    static constexpr auto message_size = std::size_t{ 32 };
+
+    auto const server = Sockets::create_server(AddressFamily::Ipv4, 0, [](ClientSocket client) {
+        while (client.is_connected()) {
+            try {
+                std::ignore = client.send(client.receive_exact(message_size).get());
+            } catch (ReadError const&) {
+                // the benchmark client disconnected => end of the measurement phase
+                break;
+            }
+        }
+    });
+
+    auto client = Sockets::create_client(AddressFamily::Ipv4, localhost, server.local_address().port);
+    auto const payload = make_payload(message_size);
+
+    auto latencies = std::vector<double>{};
+    latencies.reserve(num_round_trips);
+    for (auto i = std::size_t{ 0 }; i < num_round_trips; ++i) {
+        auto const start = Clock::now();
+        std::ignore = client.send(std::span{ payload });
+        std::ignore = client.receive_exact(message_size).get();
+        latencies.push_back(std::chrono::duration<double, std::micro>{ Clock::now() - start }.count());
+    }
+    std::ranges::sort(latencies);
+
+    print_record("round_trip_latency", std::to_string(message_size), "p50", percentile(latencies, 0.5), "us");
+    print_record("round_trip_latency", std::to_string(message_size), "p99", percentile(latencies, 0.99), "us");
+    print_record("round_trip_latency", std::to_string(message_size), "p999", percentile(latencies, 0.999), "us");
+    std::cerr << "round_trip_latency done\n";
+}
+
+// measures how many connections per second a server can accept and tear down
+static void connections_per_second() {
+    static constexpr auto num_connections = std::size_t{ 2000 };
+
+    auto const server = Sockets::create_server(AddressFamily::Ipv4, 0, [](ClientSocket client) {
+        std::ignore = client.send(std::uint8_t{ 1 }).get();
+    });
+
+    auto const start = Clock::now();
+    for (auto i = std::size_t{ 0 }; i < num_connections; ++i) {
+        auto client = Sockets::create_client(AddressFamily::Ipv4, localhost, server.local_address().port);
+        std::ignore = client.receive_exact(1).get();
+    }
+    auto const seconds = std::chrono::duration<double>{ Clock::now() - start }.count();
+
+    print_record("connections_per_second", "", "rate", static_cast<double>(num_connections) / seconds, "1/s");
+    std::cerr << "connections_per_second done\n";
+}
+
+// measures MessageBuffer serialization and parsing rates for integral fields
+static void message_buffer_rates() {
+    static constexpr auto num_values = std::size_t{ 1 << 22 };
+
+    auto values = std::vector<std::uint64_t>(num_values);
+    std::iota(values.begin(), values.end(), std::uint64_t{ 0 });
+
+    auto buffer = MessageBuffer{};
+    auto const serialize_start = Clock::now();
+    for (auto const value : values) {
+        buffer << value;
+    }
+    auto const serialize_seconds = std::chrono::duration<double>{ Clock::now() - serialize_start }.count();
+
+    auto checksum = std::uint64_t{ 0 };
+    auto const parse_start = Clock::now();
+    for (auto i = std::size_t{ 0 }; i < num_values; ++i) {
+        checksum += buffer.try_extract<std::uint64_t>().value();
+    }
+    auto const parse_seconds = std::chrono::duration<double>{ Clock::now() - parse_start }.count();
+
+    auto bulk_buffer = MessageBuffer{};
+    auto const bulk_start = Clock::now();
+    bulk_buffer << std::span{ std::as_const(values) };
+    auto extracted = std::vector<std::uint64_t>(num_values);
+    bulk_buffer >> std::span{ extracted };
+    auto const bulk_seconds = std::chrono::duration<double>{ Clock::now() - bulk_start }.count();
+
+    auto const million = 1'000'000.0;
+    print_record("message_buffer", "u64", "serialize", static_cast<double>(num_values) / serialize_seconds / million, "Mvalues/s");
+    print_record("message_buffer", "u64", "parse", static_cast<double>(num_values) / parse_seconds / million, "Mvalues/s");
+    print_record("message_buffer", "u64", "bulk_round_trip", static_cast<double>(num_values) / bulk_seconds / million, "Mvalues/s");
+    std::cerr << "message_buffer done (checksum " << checksum + extracted.back() << ")\n";
+}
+
+int main() try {
+    std::cout << "benchmark,parameter,metric,value,unit\n";
+    echo_throughput();
+    round_trip_latency();
+    connections_per_second();
+    message_buffer_rates();
+} catch (std::runtime_error const& e) {
+    std::cerr << "execution terminated unexpectedly: " << e.what();
+    return 1;
+}
@@ -30,6 +30,7 @@ if (PROJECT_IS_TOP_LEVEL)
     option(c2k_sockets_enable_thread_sanitizer "Enable thread sanitizer" ${supports_thread_sanitizer})
     option(c2k_sockets_build_examples "Build example server and client applications" ON)
     option(c2k_sockets_build_tests "Build tests using Google Test" ON)
+    option(c2k_sockets_build_benchmarks "Build performance benchmarks" ON)
 else ()
     option(c2k_sockets_warnings_as_errors "Treat warnings as errors" OFF)
     option(c2k_sockets_enable_undefined_behavior_sanitizer "Enable undefined behavior sanitizer" OFF)
@@ -37,6 +38,7 @@ else ()
     option(c2k_sockets_enable_thread_sanitizer "Enable thread sanitizer" OFF)
     option(c2k_sockets_build_examples "Build example server and client applications" OFF)
     option(c2k_sockets_build_tests "Build tests using Google Test" OFF)
+    option(c2k_sockets_build_benchmarks "Build performance benchmarks" OFF)
 endif ()
 
 add_library(c2k_sockets_warnings INTERFACE)
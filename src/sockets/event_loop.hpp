@@ -0,0 +1,99 @@
+#pragma once
+
+#include "sockets/detail/reactor.hpp"
+#include "sockets/detail/socket.hpp"
+#include "sockets/detail/wakeup.hpp"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace c2k {
+    /**
+     * @class Reactor::EventLoop
+     * @brief A single event-loop thread of a Reactor.
+     *
+     * Each event loop owns a set of registered client sockets. The loop thread waits for
+     * readiness of all registered sockets (plus an internal wakeup handle) at once and then
+     * incrementally processes the pending send and receive tasks of the sockets that became
+     * ready. New tasks, registrations and stop requests interrupt the wait via the wakeup
+     * handle.
+     */
+    class Reactor::EventLoop final {
+    private:
+        struct Registration {
+            AbstractSocket::OsSocketHandle socket;
+            ClientSocket::State* state;
+            std::optional<ClientSocket::SendTask> current_send_task;
+            std::size_t num_bytes_sent{ 0 };
+            std::optional<ClientSocket::ReceiveTask> current_receive_task;
+            std::vector<std::byte> receive_buffer;
+            std::size_t num_bytes_received{ 0 };
+            bool is_dead{ false };
+
+            Registration(AbstractSocket::OsSocketHandle const socket, ClientSocket::State& state)
+                : socket{ socket }, state{ &state } { }
+        };
+
+        detail::Wakeup m_wakeup;
+        // set while the loop thread is (about to be) blocked in poll; allows wake() to skip
+        // the pipe write while the loop is busy processing (see run())
+        std::atomic_bool m_poll_pending{ false };
+        Synchronized<std::vector<std::unique_ptr<Registration>>> m_registrations{
+            std::vector<std::unique_ptr<Registration>>{}
+        };
+        std::mutex m_generation_mutex;
+        std::condition_variable m_generation_condition_variable;
+        std::uint64_t m_generation{ 0 };
+        bool m_stopped{ false };
+        std::jthread m_thread; // must be the last member so that the loop stops first on destruction
+
+    public:
+        EventLoop();
+
+        /**
+         * @brief Registers a client socket with this event loop.
+         *
+         * @param socket The OS handle of the socket.
+         * @param state The shared state holding the socket's task queues.
+         */
+        void add_client(AbstractSocket::OsSocketHandle socket, ClientSocket::State& state);
+
+        /**
+         * @brief Removes a client socket from this event loop.
+         *
+         * This function blocks until the loop thread is guaranteed to no longer access the
+         * socket, so that the caller may safely close the OS handle afterwards.
+         *
+         * @param socket The OS handle of the socket to remove.
+         */
+        void remove_client(AbstractSocket::OsSocketHandle socket);
+
+        /**
+         * @brief Interrupts the current readiness wait of the loop thread.
+         *
+         * The pipe write only happens when the loop thread is actually (about to be) blocked
+         * in its readiness wait; while the loop is busy processing, newly enqueued tasks are
+         * picked up by its next registration scan anyway, so the syscall is skipped.
+         */
+        void wake();
+
+    private:
+        void run(std::stop_token const& stop_token);
+        void advance_generation();
+        static void activate_tasks(Registration& registration);
+        [[nodiscard]] static bool activate_next_send_task(Registration& registration);
+        [[nodiscard]] static bool activate_next_receive_task(Registration& registration);
+        static void handle_receive_timeout(Registration& registration, std::chrono::steady_clock::time_point now);
+        [[nodiscard]] static bool process_readable(Registration& registration);
+        [[nodiscard]] static bool process_readable_frame(Registration& registration);
+        [[nodiscard]] static bool process_readable_stream(Registration& registration);
+        [[nodiscard]] static bool process_writable(Registration& registration);
+        static void abandon_tasks(Registration& registration);
+    };
+} // namespace c2k
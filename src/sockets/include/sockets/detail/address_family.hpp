@@ -6,11 +6,13 @@ namespace c2k {
      * @brief Enum class representing different address families.
      *
      * The AddressFamily enum class represents different address families. Valid
-     * values are Unspecified, Ipv4, and Ipv6.
+     * values are Unspecified, Ipv4, Ipv6, and Unix (for unix domain sockets, which
+     * are addressed via filesystem paths instead of host and port).
      */
     enum class AddressFamily {
         Unspecified,
         Ipv4,
         Ipv6,
+        Unix,
     };
 }
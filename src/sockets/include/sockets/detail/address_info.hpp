@@ -1,15 +1,22 @@
 #pragma once
 
 #include <lib2k/unreachable.hpp>
+#include <array>
+#include <cstddef>
 #include <cstdint>
 #include <iostream>
+#include <string>
+#include <string_view>
 
 namespace c2k {
     /**
      * @struct AddressInfo
      * @brief Represents information about an address.
      *
-     * This structure contains information about an address, including the address family, address string, and port number.
+     * This structure contains information about an address, including the address family, the raw
+     * address bytes, and the port number. The textual representation of the address is formatted
+     * on demand (see address()), so that merely accepting a connection does not pay for any
+     * string formatting.
      */
     struct AddressInfo {
         /**
@@ -21,15 +28,60 @@ namespace c2k {
         AddressFamily family = AddressFamily::Unspecified;
 
         /**
-         * @var std::string address
-         * @brief Represents the address string, e.g. "127.0.0.1" or "localhost".
+         * @brief The raw address bytes in network byte order.
+         *
+         * Only the first 4 bytes are used for IPv4 addresses; all 16 bytes are used for IPv6
+         * addresses.
          */
-        std::string address;
+        std::array<std::byte, 16> raw_address{};
 
         /**
          * @brief Represents a port number.
          */
-        std::uint16_t port;
+        std::uint16_t port = 0;
+
+        /**
+         * @brief Formats the address as a string, e.g. "127.0.0.1".
+         *
+         * The string is computed on demand from the raw address bytes; the result is not cached.
+         *
+         * @return The textual representation of the address (an empty string if the address
+         *         family is unspecified or the socket is a unix domain socket).
+         */
+        [[nodiscard]] std::string address() const {
+            switch (family) {
+                case AddressFamily::Unspecified:
+                case AddressFamily::Unix:
+                    return {};
+                case AddressFamily::Ipv4: {
+                    auto result = std::string{};
+                    result.reserve(15);
+                    for (auto i = std::size_t{ 0 }; i < 4; ++i) {
+                        if (i != 0) {
+                            result += '.';
+                        }
+                        result += std::to_string(std::to_integer<unsigned>(raw_address[i]));
+                    }
+                    return result;
+                }
+                case AddressFamily::Ipv6: {
+                    static constexpr auto hex_digits = std::string_view{ "0123456789abcdef" };
+                    auto result = std::string{};
+                    result.reserve(39);
+                    for (auto i = std::size_t{ 0 }; i < 16; i += 2) {
+                        if (i != 0) {
+                            result += ':';
+                        }
+                        result += hex_digits[std::to_integer<std::size_t>(raw_address[i]) >> 4];
+                        result += hex_digits[std::to_integer<std::size_t>(raw_address[i]) & 0xF];
+                        result += hex_digits[std::to_integer<std::size_t>(raw_address[i + 1]) >> 4];
+                        result += hex_digits[std::to_integer<std::size_t>(raw_address[i + 1]) & 0xF];
+                    }
+                    return result;
+                }
+            }
+            unreachable();
+        }
 
         /**
          * @relates AddressInfo
@@ -47,10 +99,12 @@ namespace c2k {
             switch (address_info.family) {
                 case AddressFamily::Unspecified:
                     return ostream << "<unspecified address family>";
+                case AddressFamily::Unix:
+                    return ostream << "<unix domain socket>";
                 case AddressFamily::Ipv4:
-                    return ostream << address_info.address << ':' << address_info.port;
+                    return ostream << address_info.address() << ':' << address_info.port;
                 case AddressFamily::Ipv6:
-                    return ostream << '[' << address_info.address << "]:" << address_info.port;
+                    return ostream << '[' << address_info.address() << "]:" << address_info.port;
             }
             unreachable();
         }
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "byte_order.hpp"
+#include "utils.hpp"
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstring>
+#include <optional>
+#include <span>
+#include <tuple>
+
+namespace c2k {
+    /**
+     * @brief A compile-time schema for a fixed-layout protocol message.
+     *
+     * The class describes a message as the sequence of its field types and computes the wire
+     * layout (field offsets and total size) at compile time. Serialization writes all fields
+     * in network byte order into a fixed-size std::array without any allocation, and
+     * deserialization performs a single bounds check for the whole message instead of one per
+     * field, so the compiler can turn both into a handful of constant-offset moves.
+     *
+     * Example:
+     * @code
+     * using Header = c2k::Message<std::uint32_t, std::uint64_t, std::uint16_t>;
+     * auto const bytes = Header::serialize(id, timestamp, flags);
+     * std::ignore = client.send(bytes).get();
+     * // ...
+     * auto const [id, timestamp, flags] = Header::deserialize(received).value();
+     * @endcode
+     *
+     * @tparam Ts The field types of the message in wire order.
+     */
+    template<std::integral... Ts>
+    class Message final {
+        static_assert(sizeof...(Ts) > 0, "a message must have at least one field");
+
+    public:
+        /// the total size of the serialized message in bytes
+        static constexpr auto wire_size = detail::summed_sizeof<Ts...>();
+
+        using Values = std::tuple<Ts...>;
+        using Bytes = std::array<std::byte, wire_size>;
+
+        Message() = delete;
+
+        /**
+         * @brief Serializes the given field values into their wire representation.
+         *
+         * @param values The field values in wire order.
+         * @return An array holding the serialized message.
+         */
+        [[nodiscard]] static Bytes serialize(Ts const... values) {
+            auto bytes = Bytes{};
+            auto offset = std::size_t{ 0 };
+            auto const append = [&](auto const value) {
+                auto const network_value = to_network_byte_order(value);
+                std::memcpy(bytes.data() + offset, &network_value, sizeof(network_value));
+                offset += sizeof(network_value);
+            };
+            (append(values), ...);
+            return bytes;
+        }
+
+        /**
+         * @brief Deserializes the field values from the given wire representation.
+         *
+         * @param data The received bytes; only the first wire_size bytes are consumed.
+         * @return A tuple of the field values, or an empty optional if the data is too short.
+         */
+        [[nodiscard]] static std::optional<Values> deserialize(std::span<std::byte const> const data) {
+            if (data.size() < wire_size) {
+                return std::nullopt;
+            }
+            auto offset = std::size_t{ 0 };
+            auto const extract = [&]<typename T>() {
+                auto network_value = T{};
+                std::memcpy(&network_value, data.data() + offset, sizeof(network_value));
+                offset += sizeof(network_value);
+                return from_network_byte_order(network_value);
+            };
+            // braced initialization guarantees that the fields are extracted in wire order
+            return Values{ extract.template operator()<Ts>()... };
+        }
+    };
+} // namespace c2k
@@ -25,6 +25,7 @@ namespace c2k {
     class MessageBuffer final {
     private:
         std::vector<std::byte> m_data{};
+        std::size_t m_read_offset{ 0 };
 
     public:
         /**
@@ -42,30 +43,76 @@ namespace c2k {
         /**
          * @brief Returns the size of the MessageBuffer.
          *
-         * @return The size of the MessageBuffer in bytes.
+         * @return The number of bytes that have not been extracted yet.
          */
         [[nodiscard]] std::size_t size() const {
-            return m_data.size();
+            return m_data.size() - m_read_offset;
         }
 
         /**
-         * @brief Returns a reference to the underlying data vector.
+         * @brief Returns a view of the remaining data.
          *
-         * @return A const reference to the underlying data vector.
+         * @return A span over the bytes that have not been extracted yet.
          */
-        [[nodiscard]] std::vector<std::byte> const& data() const& {
-            return m_data;
+        [[nodiscard]] std::span<std::byte const> data() const& {
+            return std::span{ m_data }.subspan(m_read_offset);
         }
 
         /**
-         * @brief Returns the data vector by moving it.
+         * @brief Returns the remaining data by moving it out of the MessageBuffer.
          *
-         * @return The data vector of the MessageBuffer object.
+         * @return A vector containing the bytes that have not been extracted yet.
          */
         [[nodiscard]] std::vector<std::byte> data() && {
+            compact();
             return std::move(m_data);
         }
 
+        /**
+         * @brief Returns the number of bytes the MessageBuffer can hold without reallocating.
+         *
+         * @return The capacity of the underlying storage in bytes.
+         */
+        [[nodiscard]] std::size_t capacity() const {
+            return m_data.capacity();
+        }
+
+        /**
+         * @brief Reserves storage for at least the given total number of bytes.
+         *
+         * Serializing a message appends field by field; reserving the total message size up
+         * front (e.g. via detail::summed_sizeof) guarantees that the subsequent insertions do
+         * not reallocate.
+         *
+         * @param total_num_bytes The minimum capacity in bytes.
+         */
+        void reserve(std::size_t const total_num_bytes) {
+            m_data.reserve(total_num_bytes);
+        }
+
+        /**
+         * @brief Discards all contents but keeps the allocated storage.
+         *
+         * This allows reusing one MessageBuffer instance for many messages, so that the
+         * steady-state serialization path does not touch the allocator at all.
+         */
+        void clear() {
+            m_data.clear();
+            m_read_offset = 0;
+        }
+
+        /**
+         * @brief Reclaims the memory occupied by already extracted bytes.
+         *
+         * Extraction only advances a read cursor and leaves the consumed bytes in place, so that
+         * extracting field by field stays O(1) per field. Call this function after parsing large
+         * amounts of data from a long-lived buffer to release the consumed prefix.
+         */
+        void compact() {
+            m_data.erase(m_data.cbegin(), m_data.cbegin() + static_cast<std::ptrdiff_t>(m_read_offset));
+            m_read_offset = 0;
+        }
+
         /**
          * @brief Overloaded insertion operator for appending a value to a MessageBuffer.
          *
@@ -156,16 +203,22 @@ namespace c2k {
          */
         template<std::integral Integral>
         friend MessageBuffer& operator>>(MessageBuffer& message_buffer, Integral& target) {
-            if (message_buffer.m_data.size() < sizeof(target)) {
+            if (message_buffer.size() < sizeof(target)) {
                 throw std::runtime_error{ "not enough data to extract value" };
             }
             auto buffer = Integral{};
-            std::copy_n(message_buffer.m_data.cbegin(), sizeof(target), reinterpret_cast<std::byte*>(&buffer));
-            target = from_network_byte_order(buffer);
-            message_buffer.m_data.erase(
-                    message_buffer.m_data.cbegin(),
-                    message_buffer.m_data.cbegin() + sizeof(target)
+            std::copy_n(
+                    message_buffer.m_data.cbegin() + static_cast<std::ptrdiff_t>(message_buffer.m_read_offset),
+                    sizeof(target),
+                    reinterpret_cast<std::byte*>(&buffer)
             );
+            target = from_network_byte_order(buffer);
+            message_buffer.m_read_offset += sizeof(target);
+            if (message_buffer.m_read_offset == message_buffer.m_data.size()) {
+                // everything has been consumed => reset the cursor so that the storage gets reused
+                message_buffer.m_data.clear();
+                message_buffer.m_read_offset = 0;
+            }
             return message_buffer;
         }
 
@@ -182,5 +235,83 @@ namespace c2k {
             message_buffer.m_data.insert(message_buffer.m_data.end(), data.begin(), data.end());
             return message_buffer;
         }
+
+        /**
+         * @brief Appends a contiguous range of integral values to a MessageBuffer.
+         *
+         * This operator appends all values of the span to the MessageBuffer in one go. The storage
+         * is grown once up front and the values are converted to network byte order in a tight
+         * loop, which is considerably faster than inserting the values one at a time.
+         *
+         * @param message_buffer The MessageBuffer to append the values to.
+         * @param values The values to be appended to the MessageBuffer.
+         *
+         * @return A reference to the modified MessageBuffer object.
+         */
+        template<std::integral T>
+        friend MessageBuffer& operator<<(MessageBuffer& message_buffer, std::span<T const> const values) {
+            auto const old_size = message_buffer.m_data.size();
+            message_buffer.m_data.resize(old_size + values.size_bytes());
+            auto destination = message_buffer.m_data.data() + old_size;
+            for (auto const value : values) {
+                auto const network_value = to_network_byte_order(value);
+                std::memcpy(destination, &network_value, sizeof(network_value));
+                destination += sizeof(network_value);
+            }
+            return message_buffer;
+        }
+
+        /**
+         * @brief Appends a contiguous range of integral values to a MessageBuffer.
+         *
+         * Overload for spans of non-const values (see the overload taking a span of const values).
+         *
+         * @param message_buffer The MessageBuffer to append the values to.
+         * @param values The values to be appended to the MessageBuffer.
+         *
+         * @return A reference to the modified MessageBuffer object.
+         */
+        template<std::integral T>
+        friend MessageBuffer& operator<<(MessageBuffer& message_buffer, std::span<T> const values) {
+            return message_buffer << std::span<T const>{ values };
+        }
+
+        /**
+         * @brief Extracts a contiguous range of integral values from a MessageBuffer.
+         *
+         * This operator fills all elements of the span with values extracted from the
+         * MessageBuffer, converting each value from network byte order to native byte order. The
+         * values are read in a tight loop and the read cursor is advanced once, which is
+         * considerably faster than extracting the values one at a time. If the MessageBuffer does
+         * not contain enough data to fill the whole span, a std::runtime_error is thrown and the
+         * MessageBuffer remains unchanged.
+         *
+         * @param message_buffer The MessageBuffer from which to extract the values.
+         * @param targets The span whose elements receive the extracted values.
+         *
+         * @return A reference to the original MessageBuffer object after extraction.
+         *
+         * @throw std::runtime_error if not enough data is available in the MessageBuffer.
+         */
+        template<std::integral T>
+        friend MessageBuffer& operator>>(MessageBuffer& message_buffer, std::span<T> const targets) {
+            if (message_buffer.size() < targets.size_bytes()) {
+                throw std::runtime_error{ "not enough data to extract values" };
+            }
+            auto source = message_buffer.m_data.data() + message_buffer.m_read_offset;
+            for (auto& target : targets) {
+                auto network_value = T{};
+                std::memcpy(&network_value, source, sizeof(network_value));
+                target = from_network_byte_order(network_value);
+                source += sizeof(network_value);
+            }
+            message_buffer.m_read_offset += targets.size_bytes();
+            if (message_buffer.m_read_offset == message_buffer.m_data.size()) {
+                // everything has been consumed => reset the cursor so that the storage gets reused
+                message_buffer.m_data.clear();
+                message_buffer.m_read_offset = 0;
+            }
+            return message_buffer;
+        }
     };
 } // namespace c2k
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <atomic>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+namespace c2k {
+    class ClientSocket;
+    class ServerSocket;
+
+    /**
+     * @class Reactor
+     * @brief A fixed pool of event-loop threads that multiplexes many client sockets.
+     *
+     * By default, every ClientSocket spawns its own pair of send and receive threads. For
+     * applications that handle a large number of concurrent connections this does not scale,
+     * because the number of OS threads grows linearly with the number of connections. A Reactor
+     * provides an alternative: a fixed number of event-loop threads that wait for readiness of
+     * all registered sockets at once and process the pending send and receive tasks of whichever
+     * socket becomes ready. The future-based send()/receive() API of ClientSocket behaves
+     * identically in both modes.
+     *
+     * Sockets are assigned to the event loops in a round-robin fashion upon creation. A Reactor
+     * must outlive all sockets that have been created with it.
+     */
+    class Reactor final {
+        friend class ClientSocket;
+        friend class ServerSocket;
+
+    private:
+        class EventLoop;
+
+        std::vector<std::unique_ptr<EventLoop>> m_event_loops;
+        std::atomic_size_t m_next_event_loop{ 0 };
+
+    public:
+        /**
+         * @brief Creates a reactor with the given number of event-loop threads.
+         *
+         * @param num_event_loops The number of event-loop threads to spawn. If zero is passed,
+         *        the number of threads is derived from the hardware concurrency of the machine.
+         */
+        explicit Reactor(std::size_t num_event_loops = 0);
+
+        Reactor(Reactor const& other) = delete;
+        Reactor(Reactor&& other) noexcept = delete;
+        Reactor& operator=(Reactor const& other) = delete;
+        Reactor& operator=(Reactor&& other) noexcept = delete;
+        ~Reactor();
+
+        /**
+         * @brief Returns the number of event-loop threads of this reactor.
+         *
+         * @return The number of event-loop threads.
+         */
+        [[nodiscard]] std::size_t num_event_loops() const {
+            return m_event_loops.size();
+        }
+
+    private:
+        [[nodiscard]] EventLoop& next_event_loop();
+    };
+} // namespace c2k
@@ -1,8 +1,11 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <cstdint>
+#include <cstdio>
 #include <deque>
+#include <filesystem>
 #include <functional>
 #include <future>
 #include <lib2k/non_null_owner.hpp>
@@ -15,9 +18,13 @@
 #include <stdexcept>
 #include <string_view>
 #include <thread>
+#include <utility>
 #include "address_family.hpp"
 #include "address_info.hpp"
 #include "message_buffer.hpp"
+#include "reactor.hpp"
+#include "task.hpp"
+#include "wakeup.hpp"
 
 namespace c2k {
     class TimeoutError final : public std::runtime_error {
@@ -38,6 +45,61 @@ namespace c2k {
         using std::runtime_error::runtime_error;
     };
 
+    /**
+     * @brief Policies for handling a send that would exceed the configured send queue limit
+     *        (see SocketOptions::max_send_queue_bytes).
+     */
+    enum class SendQueuePolicy {
+        /// block the caller until the queue has drained enough to accept the data
+        Block,
+        /// throw a SendError without enqueuing the data
+        Fail,
+        /// complete the oldest queued sends with 0 transmitted bytes to make room
+        DropOldest,
+    };
+
+    /**
+     * @struct SocketOptions
+     * @brief Tuning knobs that are applied to a socket before any I/O starts.
+     *
+     * The defaults reproduce the previous behavior of the library. Connections over links with
+     * a high bandwidth-delay product typically need larger OS buffers than the system default
+     * (the achievable throughput is capped at buffer size divided by round trip time).
+     */
+    struct SocketOptions {
+        /// disables Nagle's algorithm to favor latency over fewer, larger segments
+        bool tcp_no_delay{ true };
+        /// enables TCP keepalive probes on the connection
+        bool keep_alive{ false };
+        /// disables delayed acknowledgements where supported (Linux only, ignored elsewhere)
+        bool quick_ack{ false };
+        /// transmits large payloads without copying them into the kernel socket buffer where
+        /// supported (Linux only, ignored elsewhere); only worthwhile for payloads of several
+        /// hundred KiB and more, since the pages have to be pinned and the transmission
+        /// completion has to be awaited on the socket error queue
+        bool zero_copy_send{ false };
+        /// size of the OS receive buffer in bytes; 0 keeps the system default
+        std::size_t receive_buffer_size{ 0 };
+        /// size of the OS send buffer in bytes; 0 keeps the system default
+        std::size_t send_buffer_size{ 0 };
+        /// upper bound for the number of bytes that may be queued for sending at once; 0 keeps
+        /// the queue unbounded, in which case a stalled consumer lets send() queue arbitrary
+        /// amounts of memory
+        std::size_t max_send_queue_bytes{ 0 };
+        /// what happens when a send would exceed max_send_queue_bytes (ignored when unbounded)
+        SendQueuePolicy send_queue_policy{ SendQueuePolicy::Block };
+        /// how long the send worker waits for further queued payloads before transmitting, so
+        /// that many small writes can leave in a single syscall (and thus fewer packets); this
+        /// buys Nagle-like batching at a bounded latency cost; 0 transmits immediately; the
+        /// wait is skipped once a batch is large enough to amortize the syscall on its own
+        std::chrono::microseconds send_coalescing_window{ 0 };
+        /// number of server threads that run the on_connect callback for accepted connections;
+        /// raise this when the callback is slow (e.g. session lookups), so that connection
+        /// handling cannot stall behind a single invocation; the callback must be thread-safe
+        /// when set to more than 1, since it may then be invoked concurrently
+        std::size_t num_connect_callback_threads{ 1 };
+    };
+
     class ClientSocket;
 
     /**
@@ -108,6 +170,46 @@ namespace c2k {
             AddressFamily address_family,
             std::uint16_t port
         );
+
+        // binds the socket to the port if host is nullptr, connects it to the host otherwise
+        [[nodiscard]] AbstractSocket::OsSocketHandle initialize_udp_socket(
+            AddressFamily address_family,
+            std::uint16_t port,
+            char const* host
+        );
+
+        template<typename Queue, typename Element = typename Queue::value_type>
+        [[nodiscard]] std::optional<Element> try_dequeue_task(Synchronized<Queue>& queue) {
+            return queue.apply([](Queue& tasks) -> std::optional<Element> {
+                if (tasks.empty()) {
+                    return std::nullopt;
+                }
+                auto result = std::move(tasks.front());
+                tasks.pop_front();
+                return result;
+            });
+        }
+
+        template<typename Queue>
+        [[nodiscard]] Queue drain_tasks(Synchronized<Queue>& queue) {
+            return queue.apply([](Queue& tasks) { return std::exchange(tasks, Queue{}); });
+        }
+
+        // every frame starts with its payload length as a big endian std::uint32_t
+        inline constexpr auto frame_header_length = std::size_t{ 4 };
+        // how many bytes the framed receive path reads from the socket at once
+        inline constexpr auto frame_chunk_length = std::size_t{ 1 } << 16;
+        // upper bound for the size of the chunks handed to an on_data callback
+        inline constexpr auto streaming_chunk_length = std::size_t{ 1 } << 16;
+        // size of the userspace staging buffer for file sends without kernel support
+        inline constexpr auto file_send_chunk_length = std::size_t{ 1 } << 18;
+        // batches at least this large amortize the send syscall on their own, so the send
+        // worker does not wait for further payloads (see SocketOptions::send_coalescing_window)
+        inline constexpr auto send_coalescing_size_budget = std::size_t{ 1 } << 14;
+
+        // if the stream holds at least one complete frame, removes it from the stream and
+        // returns its payload (without the length prefix)
+        [[nodiscard]] std::optional<std::vector<std::byte>> try_extract_frame(std::vector<std::byte>& stream);
     }
 
     /**
@@ -122,9 +224,40 @@ namespace c2k {
         friend class Sockets;
 
     private:
+        // an additional reuseport listener bound to the same port as the primary listen socket
+        struct Acceptor {
+            UniqueValue<OsSocketHandle, void (*)(OsSocketHandle handle)> socket;
+            std::jthread listen_thread;
+        };
+
         std::jthread m_listen_thread;
+        std::vector<Acceptor> m_additional_acceptors;
+        // shared with the accept loops, which may outlive a moved-from ServerSocket object
+        std::shared_ptr<std::atomic_uint64_t> m_num_connections_accepted;
+        // only set for unix domain servers; the socket file is removed again on stop()
+        std::filesystem::path m_unix_socket_path;
 
         ServerSocket(AddressFamily address_family, std::uint16_t port, std::function<void(ClientSocket)> on_connect);
+        ServerSocket(
+            AddressFamily address_family,
+            std::uint16_t port,
+            std::function<void(ClientSocket)> on_connect,
+            Reactor& reactor
+        );
+        ServerSocket(
+            AddressFamily address_family,
+            std::uint16_t port,
+            std::function<void(ClientSocket)> on_connect,
+            std::size_t num_acceptors,
+            Reactor* reactor,
+            SocketOptions const& options = SocketOptions{}
+        );
+        ServerSocket(
+            std::filesystem::path const& path,
+            std::function<void(ClientSocket)> on_connect,
+            Reactor* reactor,
+            SocketOptions const& options = SocketOptions{}
+        );
 
     public:
         ServerSocket(ServerSocket&& other) noexcept = default;
@@ -132,6 +265,26 @@ namespace c2k {
 
         ~ServerSocket();
 
+        /**
+         * @struct Statistics
+         * @brief A snapshot of the runtime statistics of a ServerSocket (see stats()).
+         */
+        struct Statistics {
+            std::uint64_t num_connections_accepted;
+        };
+
+        /**
+         * @brief Returns a snapshot of the runtime statistics of this server socket.
+         *
+         * The counter is maintained with relaxed atomic increments in the accept loops, so
+         * taking a snapshot is cheap.
+         *
+         * @return The current statistics of the server socket.
+         */
+        [[nodiscard]] Statistics stats() const {
+            return Statistics{ m_num_connections_accepted->load(std::memory_order_relaxed) };
+        }
+
         /**
          * @brief Stop the server listening thread.
          */
@@ -148,34 +301,59 @@ namespace c2k {
      */
     class ClientSocket final : public AbstractSocket {
         friend class Sockets;
+        friend class Reactor;
         friend void server_listen(
             std::stop_token const& stop_token,
             OsSocketHandle listen_socket,
-            std::function<void(ClientSocket)> const& on_connect
+            std::function<void(ClientSocket)> const& on_connect,
+            SocketOptions const& options,
+            Reactor* reactor,
+            std::atomic_uint64_t* num_connections_accepted
         );
 
     private:
+        using Timeout = std::chrono::steady_clock::duration;
+
         struct SendTask {
-            std::promise<std::size_t> promise;
-            std::vector<std::byte> data;
+            struct FileDeleter {
+                void operator()(std::FILE* const file) const {
+                    std::fclose(file);
+                }
+            };
+            using FileHandle = std::unique_ptr<std::FILE, FileDeleter>;
+
+            detail::TaskCompletion<std::size_t> promise;
+            std::vector<std::byte> storage; // owned payload (empty for sends of borrowed memory)
+            std::span<std::byte const> data; // view of the bytes to transmit
+            FileHandle file; // file-backed payload (see send_file()); nullptr for memory payloads
+            std::size_t file_length{ 0 };
+
+            SendTask(detail::TaskCompletion<std::size_t> promise, std::vector<std::byte> data)
+                : promise{ std::move(promise) }, storage{ std::move(data) }, data{ storage } {}
+
+            // the caller guarantees that the referenced memory stays alive until the promise
+            // has been fulfilled
+            SendTask(detail::TaskCompletion<std::size_t> promise, std::span<std::byte const> const data)
+                : promise{ std::move(promise) }, data{ data } {}
 
-            SendTask(std::promise<std::size_t> promise, std::vector<std::byte> data)
-                : promise{ std::move(promise) }, data{ std::move(data) } {}
+            SendTask(detail::TaskCompletion<std::size_t> promise, FileHandle file, std::size_t const file_length)
+                : promise{ std::move(promise) }, file{ std::move(file) }, file_length{ file_length } {}
         };
 
         struct ReceiveTask {
             enum class Kind {
                 Exact,
                 MaxBytes,
+                Frame,
             };
 
-            std::promise<std::vector<std::byte>> promise;
+            detail::TaskCompletion<std::vector<std::byte>> promise;
             std::size_t max_num_bytes;
             Kind kind;
             std::chrono::steady_clock::time_point end_time;
 
             ReceiveTask(
-                std::promise<std::vector<std::byte>> promise,
+                detail::TaskCompletion<std::vector<std::byte>> promise,
                 std::size_t const max_num_bytes,
                 Kind const kind,
                 std::chrono::steady_clock::time_point const end_time
@@ -183,6 +361,96 @@ namespace c2k {
                 : promise{ std::move(promise) }, max_num_bytes{ max_num_bytes }, kind{ kind }, end_time{ end_time } {}
         };
 
+    public:
+        /**
+         * @class SendAwaitable
+         * @brief Awaitable handle of an asynchronous send operation (see async_send()).
+         *
+         * The awaiter (including its completion state) is embedded in the coroutine frame, so
+         * awaiting a send does not allocate. The awaiting coroutine is resumed on the thread
+         * that completes the transmission.
+         */
+        class [[nodiscard]] SendAwaitable final {
+            friend class ClientSocket;
+
+        private:
+            ClientSocket* m_socket;
+            std::vector<std::byte> m_storage; // owned payload (empty for sends of borrowed memory)
+            std::span<std::byte const> m_data; // view of the bytes to transmit
+            detail::AwaitableState<std::size_t> m_state{};
+
+            SendAwaitable(ClientSocket& socket, std::vector<std::byte> data)
+                : m_socket{ &socket }, m_storage{ std::move(data) }, m_data{ m_storage } {}
+
+            SendAwaitable(ClientSocket& socket, std::span<std::byte const> const data)
+                : m_socket{ &socket }, m_data{ data } {}
+
+        public:
+            SendAwaitable(SendAwaitable const&) = delete;
+            SendAwaitable(SendAwaitable&&) = delete;
+            SendAwaitable& operator=(SendAwaitable const&) = delete;
+            SendAwaitable& operator=(SendAwaitable&&) = delete;
+            ~SendAwaitable() = default;
+
+            [[nodiscard]] bool await_ready() const noexcept {
+                return false;
+            }
+
+            [[nodiscard]] bool await_suspend(std::coroutine_handle<> handle);
+
+            [[nodiscard]] std::size_t await_resume() {
+                return m_state.take_result();
+            }
+        };
+
+        /**
+         * @class ReceiveAwaitable
+         * @brief Awaitable handle of an asynchronous receive operation (see async_receive() and
+         *        async_receive_exact()).
+         *
+         * The awaiter (including its completion state) is embedded in the coroutine frame, so
+         * awaiting a receive does not allocate beyond the result buffer. The awaiting coroutine
+         * is resumed on the thread that completes the reception.
+         */
+        class [[nodiscard]] ReceiveAwaitable final {
+            friend class ClientSocket;
+
+        private:
+            ClientSocket* m_socket;
+            std::size_t m_max_num_bytes;
+            ReceiveTask::Kind m_kind;
+            Timeout m_timeout;
+            detail::AwaitableState<std::vector<std::byte>> m_state{};
+
+            // clang-format off
+            ReceiveAwaitable(
+                ClientSocket& socket,
+                std::size_t const max_num_bytes,
+                ReceiveTask::Kind const kind,
+                Timeout const timeout
+            )
+                : m_socket{ &socket }, m_max_num_bytes{ max_num_bytes }, m_kind{ kind }, m_timeout{ timeout } {}
+            // clang-format on
+
+        public:
+            ReceiveAwaitable(ReceiveAwaitable const&) = delete;
+            ReceiveAwaitable(ReceiveAwaitable&&) = delete;
+            ReceiveAwaitable& operator=(ReceiveAwaitable const&) = delete;
+            ReceiveAwaitable& operator=(ReceiveAwaitable&&) = delete;
+            ~ReceiveAwaitable() = default;
+
+            [[nodiscard]] bool await_ready() const noexcept {
+                return false;
+            }
+
+            [[nodiscard]] bool await_suspend(std::coroutine_handle<> handle);
+
+            [[nodiscard]] std::vector<std::byte> await_resume() {
+                return m_state.take_result();
+            }
+        };
+
+    private:
         class State {
         private:
             NonNullOwner<std::atomic_bool> running{ make_non_null_owner<std::atomic_bool>(true) };
@@ -190,8 +458,81 @@ namespace c2k {
         public:
             Synchronized<std::deque<SendTask>> send_tasks{ std::deque<SendTask>{} };
             Synchronized<std::deque<ReceiveTask>> receive_tasks{ std::deque<ReceiveTask>{} };
+            // statistics counters, updated with relaxed ordering on the hot paths (see stats())
+            std::atomic_uint64_t num_bytes_sent{ 0 };
+            std::atomic_uint64_t num_bytes_received{ 0 };
+            std::atomic_uint64_t num_send_syscalls{ 0 };
+            std::atomic_uint64_t num_receive_syscalls{ 0 };
             std::condition_variable_any data_received_condition_variable;
             std::condition_variable_any data_sent_condition_variable;
+            // set while the corresponding worker thread is parked on its condition variable;
+            // producers skip the signal when the consumer is busy processing anyway, since it
+            // re-checks the task queue under the lock before parking (see keep_sending())
+            std::atomic_bool send_thread_parked{ false };
+            std::atomic_bool receive_thread_parked{ false };
+            // buffers stream data between framed receives; only touched by the receive path
+            // (the receive thread in threaded mode, the event loop thread in reactor mode)
+            std::vector<std::byte> framing_buffer;
+            // chunk buffer reused by the streaming receive path; only touched by the receive path
+            std::vector<std::byte> streaming_buffer;
+            // streaming subscription (see ClientSocket::set_on_data()); the flag allows the
+            // receive path to check for a subscription without taking the lock
+            Synchronized<std::function<void(std::span<std::byte const>)>> on_data{
+                std::function<void(std::span<std::byte const>)>{}
+            };
+            std::atomic_bool has_on_data{ false };
+            // send queue backpressure (see SocketOptions::max_send_queue_bytes); the byte count
+            // and the watermark flag are only modified while holding the send_tasks lock, the
+            // atomic allows reading the byte count without it
+            std::size_t max_send_queue_bytes{ 0 };
+            SendQueuePolicy send_queue_policy{ SendQueuePolicy::Block };
+            // opt-in small-write coalescing (see SocketOptions::send_coalescing_window); only
+            // read by the send thread
+            std::chrono::microseconds send_coalescing_window{ 0 };
+            std::atomic_size_t send_queue_bytes{ 0 };
+            bool send_queue_reached_watermark{ false };
+            std::condition_variable_any send_queue_shrunk_condition_variable;
+            // writable subscription (see ClientSocket::set_on_writable()); the flag allows the
+            // send path to check for a subscription without taking the lock
+            Synchronized<std::function<void()>> on_writable{ std::function<void()>{} };
+            std::atomic_bool has_on_writable{ false };
+            // zero-copy transmission bookkeeping; only touched by the send thread (the kernel
+            // numbers zero-copy sends sequentially per socket, see process_zero_copy_send_task())
+            bool zero_copy_enabled{ false };
+            std::uint32_t num_zero_copy_sends_issued{ 0 };
+            std::uint32_t num_zero_copy_sends_completed{ 0 };
+            // only present in threaded mode; interrupts the blocking readiness wait of the
+            // receive thread (reactor-driven sockets use the wakeup of their event loop)
+            std::unique_ptr<detail::Wakeup> wakeup;
+
+            explicit State(bool const use_wakeup)
+                : wakeup{ use_wakeup ? std::make_unique<detail::Wakeup>() : nullptr } {}
+
+            void invoke_on_data(std::span<std::byte const> const data) {
+                on_data.apply([data](std::function<void(std::span<std::byte const>)> const& callback) {
+                    if (callback) {
+                        callback(data);
+                    }
+                });
+            }
+
+            // file-backed payloads only ever hold one bounded staging chunk at a time and are
+            // therefore not counted against the send queue limit
+            [[nodiscard]] static std::size_t queued_send_task_bytes(SendTask const& task) {
+                return task.file == nullptr ? task.data.size() : std::size_t{ 0 };
+            }
+
+            // must be called while holding the send_tasks lock
+            void grow_send_queue(std::size_t const num_bytes) {
+                auto const total = send_queue_bytes.fetch_add(num_bytes, std::memory_order_relaxed) + num_bytes;
+                if (max_send_queue_bytes > 0 and total >= max_send_queue_bytes) {
+                    send_queue_reached_watermark = true;
+                }
+            }
+
+            void shrink_send_queue(std::size_t num_bytes);
+
+            [[nodiscard]] bool make_room_in_send_queue(std::size_t num_incoming_bytes);
 
             [[nodiscard]] bool is_running() const {
                 return *running;
@@ -205,6 +546,10 @@ namespace c2k {
                 send_tasks.apply([this](auto const&) { *running = false; });
                 data_received_condition_variable.notify_one();
                 data_sent_condition_variable.notify_one();
+                send_queue_shrunk_condition_variable.notify_all();
+                if (wakeup != nullptr) {
+                    wakeup->notify();
+                }
             }
 
             void clear_queues();
@@ -213,18 +558,57 @@ namespace c2k {
         static constexpr auto default_timeout =
             static_cast<std::chrono::steady_clock::duration>(std::chrono::seconds{ 1 });
 
-        std::unique_ptr<State> m_shared_state{ std::make_unique<State>() };
+        // shared with the background reaper, which may still be joining the send and receive
+        // threads after close() has already returned
+        std::shared_ptr<State> m_shared_state;
         std::jthread m_send_thread;
         std::jthread m_receive_thread;
+        Reactor::EventLoop* m_event_loop{ nullptr };
 
         explicit ClientSocket(OsSocketHandle os_socket_handle);
+        ClientSocket(OsSocketHandle os_socket_handle, Reactor& reactor);
         ClientSocket(AddressFamily address_family, std::string const& host, std::uint16_t port);
+        ClientSocket(AddressFamily address_family, std::string const& host, std::uint16_t port, Reactor& reactor);
+        // clang-format off
+        ClientSocket(
+            AddressFamily address_family,
+            std::string const& host,
+            std::uint16_t port,
+            SocketOptions const& options
+        );
+        ClientSocket(
+            AddressFamily address_family,
+            std::string const& host,
+            std::uint16_t port,
+            SocketOptions const& options,
+            Reactor& reactor
+        );
+        ClientSocket(
+            AddressFamily address_family,
+            std::string const& host,
+            std::uint16_t port,
+            Timeout timeout
+        );
+        ClientSocket(
+            AddressFamily address_family,
+            std::string const& host,
+            std::uint16_t port,
+            Timeout timeout,
+            Reactor& reactor
+        );
+        explicit ClientSocket(std::filesystem::path const& path);
+        ClientSocket(std::filesystem::path const& path, Reactor& reactor);
+        ClientSocket(std::filesystem::path const& path, SocketOptions const& options);
+        ClientSocket(
+            std::filesystem::path const& path,
+            SocketOptions const& options,
+            Reactor& reactor
+        );
+        // clang-format on
 
         static void keep_sending(State& state, OsSocketHandle socket);
         static void keep_receiving(State& state, OsSocketHandle socket);
 
-        using Timeout = std::chrono::steady_clock::duration;
-
     public:
         ClientSocket(ClientSocket&& other) noexcept = default;
         ClientSocket& operator=(ClientSocket&& other) noexcept = default;
@@ -258,6 +642,26 @@ namespace c2k {
         [[nodiscard("discarding the return value may lead to the data to never be transmitted")]]
         std::future<std::size_t> send(std::vector<std::byte> data);
 
+        /**
+         * @brief Sends caller-owned data through the socket without copying it.
+         *
+         * Unlike the overload taking a std::vector, this overload does not take ownership of the
+         * data. The bytes are transmitted directly from the caller-owned memory, which makes it
+         * possible to send the same buffer to many sockets without duplicating it per connection.
+         *
+         * The returned future acts as the completion handle: the caller must keep the referenced
+         * memory alive and unchanged until the future becomes ready.
+         *
+         * If the span is empty, a SendError exception will be thrown.
+         *
+         * @param data A view of the data to be sent through the socket.
+         * @return A std::future<std::size_t> that represents the amount of data that has been
+         *         transmitted. The referenced memory is no longer needed once the future is ready.
+         * @throws SendError If the span is empty.
+         */
+        [[nodiscard("the return value signals transmission completion; the data must stay alive until then")]]
+        std::future<std::size_t> send(std::span<std::byte const> data);
+
         /**
          * @brief Sends data over the socket
          *
@@ -270,6 +674,8 @@ namespace c2k {
         [[nodiscard("discarding the return value may lead to the data to never be transmitted")]]
         std::future<std::size_t> send(std::integral auto... values) {
             auto package = MessageBuffer{};
+            // one allocation of the exact message size up front, the insertions below reuse it
+            package.reserve(detail::summed_sizeof<decltype(values)...>());
             (package << ... << values);
             return send(std::move(package));
         }
@@ -290,7 +696,8 @@ namespace c2k {
          */
         [[nodiscard("discarding the return value may lead to the data to never be transmitted")]]
         std::future<std::size_t> send(MessageBuffer const& package) {
-            return send(package.data());
+            auto const data = package.data();
+            return send(std::vector<std::byte>{ data.begin(), data.end() });
         }
 
         /**
@@ -314,6 +721,25 @@ namespace c2k {
 
         // clang-format on
 
+        /**
+         * @brief Sends the contents of a file through the socket.
+         *
+         * Where the operating system supports it (Linux), the file contents are handed to the
+         * socket directly inside the kernel, so that file-backed payloads never enter
+         * userspace. On other platforms (and for reactor-driven sockets) the contents are
+         * streamed through a bounded userspace buffer instead, which still avoids loading the
+         * whole file into memory at once.
+         *
+         * The file must not be modified until the returned future becomes ready.
+         *
+         * @param path The path of the file to be sent through the socket.
+         * @return A std::future<std::size_t> that represents the amount of data that has been
+         *         transmitted.
+         * @throws SendError If the file cannot be opened or is empty.
+         */
+        [[nodiscard("discarding the return value may lead to the data to never be transmitted")]]
+        std::future<std::size_t> send_file(std::filesystem::path const& path);
+
         /**
          * @brief Asynchronously receives up to a specified maximum number of bytes from the socket
          *
@@ -372,6 +798,130 @@ namespace c2k {
          */
         [[nodiscard]] std::future<std::vector<std::byte>> receive_exact(std::size_t num_bytes, Timeout timeout);
 
+        /**
+         * @brief Sends the given message as a length-prefixed frame.
+         *
+         * The message is transmitted with its payload length prepended as a big endian
+         * std::uint32_t, so that the receiving side can reassemble whole messages from the
+         * byte stream via receive_frame(). Compared to hand-rolled framing on top of
+         * receive_exact(), this costs a single queued task per frame instead of one for the
+         * length prefix and another one for the body.
+         *
+         * @param message The message to be sent as a single frame.
+         * @return A std::future<std::size_t> that represents the amount of data that has been
+         *         transmitted (including the length prefix).
+         * @throws SendError If the message is empty.
+         */
+        [[nodiscard("discarding the return value may lead to the data to never be transmitted")]]
+        std::future<std::size_t> send_framed(MessageBuffer message);
+
+        /**
+         * @brief Receives one length-prefixed frame from the socket.
+         *
+         * The frame format matches send_framed(): a big endian std::uint32_t payload length
+         * followed by the payload. Incoming bytes are buffered per socket, so a single kernel
+         * read can complete many frames and each frame costs at most one promise fulfillment;
+         * frames that are already buffered complete without any syscall.
+         *
+         * @return A future that holds the payload of the received frame (without the length
+         *         prefix). If no complete frame arrives within the default timeout of 1 second,
+         *         an exception will be stored in the future.
+         */
+        [[nodiscard]] std::future<std::vector<std::byte>> receive_frame();
+
+        /**
+         * @brief Receives one length-prefixed frame from the socket.
+         *
+         * Like receive_frame(), but with an explicit timeout.
+         *
+         * @param timeout The maximum amount of time to wait for a complete frame.
+         * @return A future that holds the payload of the received frame (without the length
+         *         prefix). If no complete frame arrives within the specified timeout, an
+         *         exception will be stored in the future.
+         */
+        [[nodiscard]] std::future<std::vector<std::byte>> receive_frame(Timeout timeout);
+
+        /**
+         * @brief Sends the given data through the socket, awaitable from a coroutine.
+         *
+         * This is the coroutine counterpart of send(): co_awaiting the returned object suspends
+         * the coroutine until the data has been transmitted and yields the number of bytes
+         * sent. Unlike the future-based API, no heap allocation is performed for the completion
+         * handling; the awaiter lives inside the coroutine frame.
+         *
+         * The coroutine is resumed on the thread that completes the transmission; the socket
+         * must therefore not be destroyed from inside the awaiting coroutine.
+         *
+         * @param data The data to be sent through the socket.
+         * @return An awaitable yielding the number of bytes that have been transmitted.
+         * @throws SendError If the data vector is empty.
+         */
+        [[nodiscard]] SendAwaitable async_send(std::vector<std::byte> data);
+
+        /**
+         * @brief Sends caller-owned data through the socket, awaitable from a coroutine.
+         *
+         * Like the overload taking a std::vector, but the bytes are transmitted directly from
+         * the caller-owned memory without copying it. The referenced memory must stay alive and
+         * unchanged until the co_await expression yields.
+         *
+         * @param data A view of the data to be sent through the socket.
+         * @return An awaitable yielding the number of bytes that have been transmitted.
+         * @throws SendError If the span is empty.
+         */
+        [[nodiscard]] SendAwaitable async_send(std::span<std::byte const> data);
+
+        /**
+         * @brief Receives up to a specified maximum number of bytes, awaitable from a coroutine.
+         *
+         * This is the coroutine counterpart of receive(): co_awaiting the returned object
+         * suspends the coroutine until data has arrived (or the default timeout of 1 second has
+         * expired) and yields the received bytes.
+         *
+         * @param max_num_bytes The maximum number of bytes to receive from the socket.
+         * @return An awaitable yielding the received bytes.
+         * @throws ReadError If max_num_bytes is 0.
+         */
+        [[nodiscard]] ReceiveAwaitable async_receive(std::size_t max_num_bytes);
+
+        /**
+         * @brief Receives up to a specified maximum number of bytes, awaitable from a coroutine.
+         *
+         * Like async_receive(std::size_t), but with an explicit timeout.
+         *
+         * @param max_num_bytes The maximum number of bytes to receive from the socket.
+         * @param timeout The maximum amount of time to wait for incoming data.
+         * @return An awaitable yielding the received bytes.
+         * @throws ReadError If max_num_bytes is 0.
+         */
+        [[nodiscard]] ReceiveAwaitable async_receive(std::size_t max_num_bytes, Timeout timeout);
+
+        /**
+         * @brief Receives an exact number of bytes, awaitable from a coroutine.
+         *
+         * This is the coroutine counterpart of receive_exact(): co_awaiting the returned object
+         * suspends the coroutine until exactly num_bytes bytes have arrived and yields them. If
+         * the default timeout of 1 second expires first, a TimeoutError is thrown from the
+         * co_await expression.
+         *
+         * @param num_bytes The number of bytes to receive.
+         * @return An awaitable yielding the received bytes.
+         * @throws ReadError If num_bytes is 0.
+         */
+        [[nodiscard]] ReceiveAwaitable async_receive_exact(std::size_t num_bytes);
+
+        /**
+         * @brief Receives an exact number of bytes, awaitable from a coroutine.
+         *
+         * Like async_receive_exact(std::size_t), but with an explicit timeout.
+         *
+         * @param num_bytes The number of bytes to receive.
+         * @param timeout The timeout for the receive operation.
+         * @return An awaitable yielding the received bytes.
+         * @throws ReadError If num_bytes is 0.
+         */
+        [[nodiscard]] ReceiveAwaitable async_receive_exact(std::size_t num_bytes, Timeout timeout);
+
         /**
          * Reads one or multiple integral values from the socket.
          *
@@ -392,11 +942,75 @@ namespace c2k {
             });
         }
 
+        /**
+         * @brief Subscribes to incoming data with a streaming callback.
+         *
+         * While a callback is installed, the receive path pushes incoming bytes straight to
+         * the callback instead of fulfilling queued receive tasks, which eliminates the
+         * per-chunk task allocation, condition variable signal and future round trip of
+         * calling receive() in a loop. The callback is invoked on the receive thread (or the
+         * event loop thread for reactor-driven sockets) and must not destroy the socket; when
+         * the connection is closed by the peer, it is invoked one final time with an empty
+         * span. The passed span is only valid for the duration of the invocation.
+         *
+         * Streaming and the task-based receive functions are mutually exclusive: receive
+         * tasks that are enqueued while a callback is installed are only processed after the
+         * subscription has been removed by passing an empty function.
+         *
+         * @param callback The callback to invoke for every chunk of incoming data, or an
+         *        empty function to unsubscribe.
+         */
+        void set_on_data(std::function<void(std::span<std::byte const>)> callback);
+
+        /**
+         * @brief Subscribes to a notification when the send queue has drained.
+         *
+         * The callback is only ever invoked on sockets with a configured send queue limit (see
+         * SocketOptions::max_send_queue_bytes): once the queued bytes have reached the limit
+         * and subsequently drop below half of it, the callback is invoked a single time. This
+         * allows a producer that uses SendQueuePolicy::Fail or SendQueuePolicy::DropOldest to
+         * pause on a failed send and resume writing without polling stats(). The callback is
+         * invoked on the send thread (or the event loop thread for reactor-driven sockets) and
+         * must not destroy the socket.
+         *
+         * @param callback The callback to invoke when the send queue has drained, or an empty
+         *        function to unsubscribe.
+         */
+        void set_on_writable(std::function<void()> callback);
+
+        /**
+         * @struct Statistics
+         * @brief A snapshot of the runtime statistics of a ClientSocket (see stats()).
+         */
+        struct Statistics {
+            std::uint64_t num_bytes_sent;
+            std::uint64_t num_bytes_received;
+            std::uint64_t num_send_syscalls;
+            std::uint64_t num_receive_syscalls;
+            std::size_t num_pending_send_tasks;
+            std::size_t num_pending_receive_tasks;
+        };
+
+        /**
+         * @brief Returns a snapshot of the runtime statistics of this socket.
+         *
+         * The counters are maintained with relaxed atomic increments on the send and receive
+         * paths, so taking a snapshot is cheap and does not interfere with ongoing operations.
+         * This makes it possible to find backlogged connections (e.g. by looking at the pending
+         * send task count) without attaching a profiler.
+         *
+         * @return The current statistics of the socket.
+         */
+        [[nodiscard]] Statistics stats() const;
+
         /**
          * @brief Closes the client socket
          *
          * This method closes the client socket and performs necessary cleanup operations. It stops
-         * the socket from running and clears any pending queues.
+         * the socket from running and clears any pending queues. The call returns immediately: the
+         * send and receive threads are joined (and the OS handle is closed) by a shared background
+         * reaper thread, so that dropping many connections at once does not serialize their
+         * teardown on the caller's thread.
          */
         void close();
 
@@ -408,7 +1022,24 @@ namespace c2k {
             std::optional<std::chrono::steady_clock::time_point> end_time
         );
         // clang-format on
-        [[nodiscard]] static bool process_receive_task(OsSocketHandle socket, ReceiveTask task);
-        [[nodiscard]] static bool process_send_task(OsSocketHandle socket, SendTask task);
+        [[nodiscard]] static bool process_receive_task(State& state, OsSocketHandle socket, ReceiveTask task);
+        [[nodiscard]] static bool process_receive_frame_task(State& state, OsSocketHandle socket, ReceiveTask task);
+        [[nodiscard]] static bool stream_incoming_data(State& state, OsSocketHandle socket);
+        [[nodiscard]] static bool process_send_tasks(State& state, OsSocketHandle socket, std::deque<SendTask> tasks);
+        [[nodiscard]] static bool process_file_send_task(State& state, OsSocketHandle socket, SendTask& task);
+        // only defined (and called) on platforms that support zero-copy transmission
+        [[nodiscard]] static bool process_zero_copy_send_task(State& state, OsSocketHandle socket, SendTask& task);
+        // reads the next chunk of a file-backed payload into the task storage; returns false
+        // once the file is exhausted
+        [[nodiscard]] static bool refill_file_chunk(SendTask& task);
+
+        void configure_send_queue(SocketOptions const& options) {
+            m_shared_state->max_send_queue_bytes = options.max_send_queue_bytes;
+            m_shared_state->send_queue_policy = options.send_queue_policy;
+            m_shared_state->send_coalescing_window = options.send_coalescing_window;
+        }
+
+        void notify_send_task_enqueued();
+        void notify_receive_task_enqueued();
     };
 }  // namespace c2k
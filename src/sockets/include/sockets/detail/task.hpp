@@ -0,0 +1,278 @@
+#pragma once
+
+#include <atomic>
+#include <coroutine>
+#include <exception>
+#include <future>
+#include <optional>
+#include <semaphore>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+namespace c2k {
+    namespace detail {
+        /**
+         * @brief Completion state of a pending awaitable socket operation.
+         *
+         * The state is embedded in the awaiter object and therefore lives inside the coroutine
+         * frame, so a socket operation performed via co_await does not allocate. The socket
+         * thread that finishes the operation races against the coroutine suspending; the atomic
+         * continuation slot arbitrates which side resumes the coroutine.
+         */
+        template<typename T>
+        class AwaitableState final {
+        private:
+            std::atomic<void*> m_continuation{ nullptr };
+            std::optional<T> m_value{};
+            std::exception_ptr m_exception{};
+
+            [[nodiscard]] static void* completed_marker() {
+                static char marker{};
+                return &marker;
+            }
+
+            void complete() {
+                auto const continuation = m_continuation.exchange(completed_marker(), std::memory_order_acq_rel);
+                if (continuation != nullptr) {
+                    // the coroutine suspended before we finished => resume it on this thread;
+                    // the frame (and with it this object) may be gone once resume() returns
+                    std::coroutine_handle<>::from_address(continuation).resume();
+                }
+            }
+
+        public:
+            AwaitableState() = default;
+            AwaitableState(AwaitableState const&) = delete;
+            AwaitableState(AwaitableState&&) = delete;
+            AwaitableState& operator=(AwaitableState const&) = delete;
+            AwaitableState& operator=(AwaitableState&&) = delete;
+            ~AwaitableState() = default;
+
+            void set_value(T value) {
+                m_value = std::move(value);
+                complete();
+            }
+
+            void set_exception(std::exception_ptr exception) {
+                m_exception = std::move(exception);
+                complete();
+            }
+
+            /**
+             * @brief Installs the coroutine to resume once the operation completes.
+             *
+             * @param continuation The coroutine that is about to suspend.
+             * @return True if the coroutine was suspended, false if the operation already
+             *         completed (in which case the caller must not suspend).
+             */
+            [[nodiscard]] bool try_set_continuation(std::coroutine_handle<> const continuation) {
+                auto expected = static_cast<void*>(nullptr);
+                return m_continuation.compare_exchange_strong(
+                        expected,
+                        continuation.address(),
+                        std::memory_order_acq_rel,
+                        std::memory_order_acquire
+                );
+            }
+
+            [[nodiscard]] T take_result() {
+                if (m_exception != nullptr) {
+                    std::rethrow_exception(m_exception);
+                }
+                return std::move(m_value).value();
+            }
+        };
+
+        /**
+         * @brief Completion handle of a queued send or receive task.
+         *
+         * Fulfills either a std::promise (for the future-based API) or an AwaitableState (for
+         * the coroutine-based API), so that the task processing code does not have to know
+         * which API issued the task.
+         */
+        template<typename T>
+        class TaskCompletion final {
+        private:
+            std::variant<std::promise<T>, AwaitableState<T>*> m_target;
+
+        public:
+            TaskCompletion(std::promise<T> promise) // NOLINT (implicit conversion is intended)
+                : m_target{ std::move(promise) } {}
+
+            explicit TaskCompletion(AwaitableState<T>& awaitable_state)
+                : m_target{ &awaitable_state } {}
+
+            void set_value(T value) {
+                if (auto const promise = std::get_if<std::promise<T>>(&m_target)) {
+                    promise->set_value(std::move(value));
+                } else {
+                    std::get<AwaitableState<T>*>(m_target)->set_value(std::move(value));
+                }
+            }
+
+            void set_exception(std::exception_ptr exception) {
+                if (auto const promise = std::get_if<std::promise<T>>(&m_target)) {
+                    promise->set_exception(std::move(exception));
+                } else {
+                    std::get<AwaitableState<T>*>(m_target)->set_exception(std::move(exception));
+                }
+            }
+        };
+
+        template<typename T>
+        struct TaskPromiseStorage {
+            std::optional<T> value{};
+
+            void return_value(T returned_value) {
+                value = std::move(returned_value);
+            }
+
+            [[nodiscard]] T take() {
+                return std::move(value).value();
+            }
+        };
+
+        template<>
+        struct TaskPromiseStorage<void> {
+            void return_void() const noexcept {}
+
+            void take() const noexcept {}
+        };
+    } // namespace detail
+
+    /**
+     * @brief A lazily started coroutine that produces a value of type T.
+     *
+     * Task is the coroutine return type to use together with the awaitable socket operations
+     * (e.g. ClientSocket::async_send() and ClientSocket::async_receive_exact()). A Task does not
+     * run until it is either co_awaited from another coroutine or driven to completion via
+     * get(). Note that the body of a Task is resumed on the thread that completes the awaited
+     * socket operation; a ClientSocket must therefore not be destroyed from inside a Task that
+     * awaits one of its operations.
+     */
+    template<typename T = void>
+    class [[nodiscard]] Task final {
+    public:
+        struct promise_type final : detail::TaskPromiseStorage<T> {
+            std::exception_ptr exception{};
+            std::coroutine_handle<> continuation{};
+            std::binary_semaphore* completion_signal{ nullptr };
+
+            [[nodiscard]] Task get_return_object() {
+                return Task{ std::coroutine_handle<promise_type>::from_promise(*this) };
+            }
+
+            [[nodiscard]] std::suspend_always initial_suspend() const noexcept {
+                return {};
+            }
+
+            [[nodiscard]] auto final_suspend() const noexcept {
+                struct FinalAwaiter {
+                    [[nodiscard]] bool await_ready() const noexcept {
+                        return false;
+                    }
+
+                    [[nodiscard]] std::coroutine_handle<> await_suspend(
+                            std::coroutine_handle<promise_type> const handle
+                    ) const noexcept {
+                        auto& promise = handle.promise();
+                        if (promise.completion_signal != nullptr) {
+                            promise.completion_signal->release();
+                        } else if (promise.continuation) {
+                            return promise.continuation;
+                        }
+                        return std::noop_coroutine();
+                    }
+
+                    void await_resume() const noexcept {}
+                };
+                return FinalAwaiter{};
+            }
+
+            void unhandled_exception() {
+                exception = std::current_exception();
+            }
+        };
+
+    private:
+        std::coroutine_handle<promise_type> m_handle;
+
+        explicit Task(std::coroutine_handle<promise_type> const handle)
+            : m_handle{ handle } {}
+
+    public:
+        Task(Task const&) = delete;
+        Task& operator=(Task const&) = delete;
+
+        Task(Task&& other) noexcept
+            : m_handle{ std::exchange(other.m_handle, nullptr) } {}
+
+        Task& operator=(Task&& other) noexcept {
+            if (this != std::addressof(other)) {
+                if (m_handle) {
+                    m_handle.destroy();
+                }
+                m_handle = std::exchange(other.m_handle, nullptr);
+            }
+            return *this;
+        }
+
+        ~Task() {
+            if (m_handle) {
+                m_handle.destroy();
+            }
+        }
+
+        /**
+         * @brief Makes the Task awaitable from another coroutine.
+         *
+         * The awaiting coroutine suspends, the Task runs, and the awaiting coroutine is resumed
+         * with the result once the Task finishes (exceptions are rethrown).
+         */
+        [[nodiscard]] auto operator co_await() && {
+            struct Awaiter {
+                std::coroutine_handle<promise_type> handle;
+
+                [[nodiscard]] bool await_ready() const noexcept {
+                    return false;
+                }
+
+                [[nodiscard]] std::coroutine_handle<> await_suspend(
+                        std::coroutine_handle<> const continuation
+                ) const noexcept {
+                    handle.promise().continuation = continuation;
+                    return handle;
+                }
+
+                T await_resume() const {
+                    auto& promise = handle.promise();
+                    if (promise.exception != nullptr) {
+                        std::rethrow_exception(promise.exception);
+                    }
+                    return promise.take();
+                }
+            };
+            return Awaiter{ m_handle };
+        }
+
+        /**
+         * @brief Runs the Task to completion, blocking the calling thread.
+         *
+         * This is the bridge from regular code into coroutine code: it starts the Task, waits
+         * until it has finished, and returns its result (exceptions are rethrown).
+         *
+         * @return The value produced by the Task.
+         */
+        T get() && {
+            auto completion_signal = std::binary_semaphore{ 0 };
+            m_handle.promise().completion_signal = &completion_signal;
+            m_handle.resume();
+            completion_signal.acquire();
+            if (m_handle.promise().exception != nullptr) {
+                std::rethrow_exception(m_handle.promise().exception);
+            }
+            return m_handle.promise().take();
+        }
+    };
+} // namespace c2k
@@ -0,0 +1,74 @@
+#pragma once
+
+#include "socket.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace c2k {
+    /**
+     * @class UdpSocket
+     * @brief Represents a datagram (UDP) socket.
+     *
+     * Unlike ClientSocket, a UdpSocket performs its operations synchronously on the calling
+     * thread and preserves datagram boundaries. send() and receive() work on whole batches of
+     * datagrams, which are handed to the operating system in as few syscalls as possible (a
+     * single sendmmsg/recvmmsg call per batch on Linux), since per-datagram syscalls dominate
+     * the cost of small packets.
+     */
+    class UdpSocket final : public AbstractSocket {
+        friend class Sockets;
+
+    private:
+        UdpSocket(AddressFamily address_family, std::uint16_t port);
+        UdpSocket(AddressFamily address_family, std::string const& host, std::uint16_t port);
+
+    public:
+        UdpSocket(UdpSocket&& other) noexcept = default;
+        UdpSocket& operator=(UdpSocket&& other) noexcept = default;
+
+        /**
+         * @brief Sends a single datagram.
+         *
+         * The socket must have been created with a destination (see
+         * Sockets::create_udp_socket() taking a host).
+         *
+         * @param datagram The payload of the datagram.
+         * @return The number of bytes sent.
+         * @throws SendError If the datagram is empty or sending fails.
+         */
+        std::size_t send(std::span<std::byte const> datagram);
+
+        /**
+         * @brief Sends a batch of datagrams.
+         *
+         * Each vector is sent as one datagram. On Linux the whole batch is passed to the kernel
+         * via sendmmsg; on other platforms the datagrams are sent one by one.
+         *
+         * @param datagrams The payloads of the datagrams.
+         * @return The number of datagrams sent (may be less than requested if the operating
+         *         system could not queue all of them).
+         * @throws SendError If sending fails.
+         */
+        std::size_t send(std::span<std::vector<std::byte> const> datagrams);
+
+        /**
+         * @brief Receives a batch of datagrams.
+         *
+         * Blocks until at least one datagram has arrived and then returns all datagrams that
+         * are immediately available, up to max_num_datagrams. On Linux the whole batch is read
+         * via a single recvmmsg call. Datagrams larger than max_datagram_size are truncated.
+         *
+         * @param max_num_datagrams The maximum number of datagrams to receive.
+         * @param max_datagram_size The maximum size of a single datagram in bytes.
+         * @return The payloads of the received datagrams, one vector per datagram.
+         * @throws ReadError If receiving fails or the arguments are 0.
+         */
+        [[nodiscard]] std::vector<std::vector<std::byte>> receive(
+                std::size_t max_num_datagrams,
+                std::size_t max_datagram_size
+        );
+    };
+} // namespace c2k
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstdint>
+
+namespace c2k::detail {
+    /**
+     * @class Wakeup
+     * @brief A self-pipe style wakeup primitive for interrupting blocking readiness waits.
+     *
+     * This class wraps a pair of connected OS handles (a pipe on POSIX systems, a pair of
+     * loopback sockets on Windows). The read end can be added to a poll/select call together
+     * with regular sockets, so that another thread can interrupt the wait by calling notify().
+     */
+    class Wakeup final {
+    public:
+#ifdef _WIN32
+        using OsHandle = std::uintptr_t;
+#else
+        using OsHandle = int;
+#endif
+
+    private:
+        OsHandle m_read_handle;
+        OsHandle m_write_handle;
+
+    public:
+        Wakeup();
+        Wakeup(Wakeup const& other) = delete;
+        Wakeup(Wakeup&& other) noexcept = delete;
+        Wakeup& operator=(Wakeup const& other) = delete;
+        Wakeup& operator=(Wakeup&& other) noexcept = delete;
+        ~Wakeup();
+
+        /**
+         * @brief Interrupts a pending (or the next) readiness wait on the read handle.
+         *
+         * This function is safe to call from any thread and never blocks.
+         */
+        void notify();
+
+        /**
+         * @brief Consumes all pending notifications.
+         *
+         * This function should be called after the read handle became readable, so that
+         * subsequent waits block again until the next call to notify().
+         */
+        void clear();
+
+        /**
+         * @brief Returns the handle that becomes readable when notify() is called.
+         *
+         * @return The OS handle of the read end.
+         */
+        [[nodiscard]] OsHandle read_handle() const {
+            return m_read_handle;
+        }
+    };
+} // namespace c2k::detail
@@ -0,0 +1,547 @@
+#include "event_loop.hpp"
+#include "socket_headers.hpp"
+#include <algorithm>
+#include <cassert>
+#include <cerrno>
+#include <chrono>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+namespace c2k {
+    using detail::PollFileDescriptor;
+
+    using detail::set_non_blocking;
+
+    [[nodiscard]] static bool last_operation_would_block() {
+#ifdef _WIN32
+        return WSAGetLastError() == WSAEWOULDBLOCK;
+#elif EAGAIN == EWOULDBLOCK
+        // both codes are the same value (e.g. on glibc), and comparing against it twice would
+        // trigger -Wlogical-op
+        return errno == EAGAIN;
+#else
+        return errno == EAGAIN or errno == EWOULDBLOCK;
+#endif
+    }
+
+    Reactor::Reactor(std::size_t num_event_loops) {
+        if (num_event_loops == 0) {
+            num_event_loops = std::max(std::size_t{ 1 }, static_cast<std::size_t>(std::thread::hardware_concurrency()));
+        }
+        m_event_loops.reserve(num_event_loops);
+        for (auto i = std::size_t{ 0 }; i < num_event_loops; ++i) {
+            m_event_loops.push_back(std::make_unique<EventLoop>());
+        }
+    }
+
+    Reactor::~Reactor() = default;
+
+    [[nodiscard]] Reactor::EventLoop& Reactor::next_event_loop() {
+        return *m_event_loops[m_next_event_loop.fetch_add(1) % m_event_loops.size()];
+    }
+
+    Reactor::EventLoop::EventLoop()
+        : m_thread{ [this](std::stop_token const& stop_token) { run(stop_token); } } { }
+
+    void Reactor::EventLoop::add_client(AbstractSocket::OsSocketHandle const socket, ClientSocket::State& state) {
+        set_non_blocking(socket);
+        m_registrations.apply([&](std::vector<std::unique_ptr<Registration>>& registrations) {
+            registrations.push_back(std::make_unique<Registration>(socket, state));
+        });
+        wake();
+    }
+
+    void Reactor::EventLoop::remove_client(AbstractSocket::OsSocketHandle const socket) {
+        auto const found = m_registrations.apply([socket](std::vector<std::unique_ptr<Registration>>& registrations) {
+            auto const iterator = std::find_if(
+                    registrations.begin(),
+                    registrations.end(),
+                    [socket](std::unique_ptr<Registration> const& registration) {
+                        return registration->socket == socket;
+                    }
+            );
+            if (iterator == registrations.end()) {
+                return false;
+            }
+            abandon_tasks(**iterator);
+            registrations.erase(iterator);
+            return true;
+        });
+        if (not found) {
+            return;
+        }
+
+        // the loop thread may still be inside a poll call that includes the socket, so we have to
+        // wait until the current poll cycle has finished before the caller may close the OS handle
+        auto lock = std::unique_lock{ m_generation_mutex };
+        auto const current_generation = m_generation;
+        m_wakeup.notify();
+        m_generation_condition_variable.wait(lock, [this, current_generation] {
+            return m_stopped or m_generation != current_generation;
+        });
+    }
+
+    void Reactor::EventLoop::wake() {
+        if (m_poll_pending.exchange(false, std::memory_order_acq_rel)) {
+            m_wakeup.notify();
+        }
+    }
+
+    void Reactor::EventLoop::advance_generation() {
+        {
+            auto const lock = std::scoped_lock{ m_generation_mutex };
+            ++m_generation;
+        }
+        m_generation_condition_variable.notify_all();
+    }
+
+    void Reactor::EventLoop::activate_tasks(Registration& registration) {
+        std::ignore = activate_next_send_task(registration);
+        std::ignore = activate_next_receive_task(registration);
+    }
+
+    [[nodiscard]] bool Reactor::EventLoop::activate_next_send_task(Registration& registration) {
+        while (not registration.current_send_task.has_value()) {
+            registration.current_send_task = detail::try_dequeue_task(registration.state->send_tasks);
+            registration.num_bytes_sent = 0;
+            if (not registration.current_send_task.has_value()) {
+                return false;
+            }
+            if (registration.current_send_task->file != nullptr) {
+                // the event loop must not block on file I/O for long, so file-backed payloads
+                // are streamed through a bounded userspace buffer chunk by chunk
+                if (not ClientSocket::refill_file_chunk(*registration.current_send_task)) {
+                    // the file shrank to zero in the meantime
+                    registration.current_send_task->promise.set_value(0);
+                    registration.current_send_task.reset();
+                }
+                continue;
+            }
+            if (not std::in_range<constants::SendReceiveSize>(registration.current_send_task->data.size())) {
+                registration.current_send_task->promise.set_exception(std::make_exception_ptr(
+                        std::runtime_error{ "size of message to be sent exceeds allowed maximum" }
+                ));
+                auto const num_queued_bytes =
+                        ClientSocket::State::queued_send_task_bytes(*registration.current_send_task);
+                registration.current_send_task.reset();
+                registration.state->shrink_send_queue(num_queued_bytes);
+            }
+        }
+        return true;
+    }
+
+    [[nodiscard]] bool Reactor::EventLoop::activate_next_receive_task(Registration& registration) {
+        while (not registration.current_receive_task.has_value()) {
+            registration.current_receive_task = detail::try_dequeue_task(registration.state->receive_tasks);
+            if (not registration.current_receive_task.has_value()) {
+                return false;
+            }
+            if (registration.current_receive_task->kind == ClientSocket::ReceiveTask::Kind::Frame) {
+                // frames that are already buffered complete without any syscall
+                if (auto frame = detail::try_extract_frame(registration.state->framing_buffer)) {
+                    registration.current_receive_task->promise.set_value(*std::move(frame));
+                    registration.current_receive_task.reset();
+                    continue;
+                }
+                // framed receives read directly into the tail of the framing buffer, so the
+                // regular result buffer is not needed
+                registration.num_bytes_received = 0;
+                continue;
+            }
+            if (not std::in_range<constants::SendReceiveSize>(registration.current_receive_task->max_num_bytes)) {
+                registration.current_receive_task->promise.set_exception(std::make_exception_ptr(
+                        std::runtime_error{ "size of message to be received exceeds allowed maximum" }
+                ));
+                registration.current_receive_task.reset();
+                continue;
+            }
+            // the result buffer is allocated once up front and the data is received directly into
+            // its tail, so the steady-state receive path performs no further allocations or copies
+            registration.receive_buffer.resize(registration.current_receive_task->max_num_bytes);
+            registration.num_bytes_received = 0;
+        }
+        return true;
+    }
+
+    // clang-format off
+    void Reactor::EventLoop::handle_receive_timeout(
+        Registration& registration,
+        std::chrono::steady_clock::time_point const now
+    ) { // clang-format on
+        if (not registration.current_receive_task.has_value()) {
+            return;
+        }
+        auto& task = *registration.current_receive_task;
+        if (now < task.end_time) {
+            return;
+        }
+        if (task.kind == ClientSocket::ReceiveTask::Kind::MaxBytes) {
+            registration.receive_buffer.resize(registration.num_bytes_received);
+            task.promise.set_value(std::move(registration.receive_buffer));
+        } else {
+            // exact and framed receives either complete in full or time out
+            task.promise.set_exception(std::make_exception_ptr(TimeoutError{}));
+        }
+        registration.current_receive_task.reset();
+        registration.receive_buffer = {};
+        registration.num_bytes_received = 0;
+    }
+
+    [[nodiscard]] bool Reactor::EventLoop::process_readable(Registration& registration) {
+        if (registration.state->has_on_data.load(std::memory_order_acquire)) {
+            // streaming mode supersedes the task-based receive path (see ClientSocket::set_on_data())
+            return process_readable_stream(registration);
+        }
+
+        // a single readiness notification may complete many queued receive tasks: we keep reading
+        // until the socket would block or no further tasks are pending, which amortizes the cost
+        // of the poll syscall over all completed tasks
+        while (registration.current_receive_task.has_value()) {
+            auto& task = *registration.current_receive_task;
+            if (task.kind == ClientSocket::ReceiveTask::Kind::Frame) {
+                if (not process_readable_frame(registration)) {
+                    return false;
+                }
+                if (registration.current_receive_task.has_value()) {
+                    // the socket would block before the frame was complete
+                    return true;
+                }
+                if (not activate_next_receive_task(registration)) {
+                    break;
+                }
+                continue;
+            }
+            auto& receive_buffer = registration.receive_buffer;
+            assert(registration.num_bytes_received < task.max_num_bytes);
+
+            // clang-format off
+            auto const receive_result = recv(
+                registration.socket,
+                reinterpret_cast<char*>(receive_buffer.data()) + registration.num_bytes_received,
+                static_cast<constants::SendReceiveSize>(task.max_num_bytes - registration.num_bytes_received),
+                0
+            );
+            // clang-format on
+            registration.state->num_receive_syscalls.fetch_add(1, std::memory_order_relaxed);
+
+            if (receive_result == constants::socket_error and last_operation_would_block()) {
+                // no more incoming data for now, try again on the next readiness notification
+                return true;
+            }
+
+            if (receive_result == 0 or receive_result == constants::socket_error) {
+                // connection has been gracefully closed or connection no longer active => close socket
+                if (task.kind == ClientSocket::ReceiveTask::Kind::Exact) {
+                    task.promise.set_exception(std::make_exception_ptr(ReadError{}));
+                } else {
+                    receive_buffer.resize(registration.num_bytes_received);
+                    task.promise.set_value(std::move(receive_buffer));
+                }
+                registration.current_receive_task.reset();
+                registration.receive_buffer = {};
+                registration.num_bytes_received = 0;
+                return false;
+            }
+
+            registration.num_bytes_received += static_cast<std::size_t>(receive_result);
+            registration.state->num_bytes_received.fetch_add(
+                    static_cast<std::uint64_t>(receive_result),
+                    std::memory_order_relaxed
+            );
+
+            if (task.kind == ClientSocket::ReceiveTask::Kind::MaxBytes
+                or registration.num_bytes_received >= task.max_num_bytes) {
+                assert(registration.num_bytes_received <= task.max_num_bytes);
+                receive_buffer.resize(registration.num_bytes_received);
+                task.promise.set_value(std::move(receive_buffer));
+                registration.current_receive_task.reset();
+                registration.receive_buffer = {};
+                registration.num_bytes_received = 0;
+                if (not activate_next_receive_task(registration)) {
+                    break;
+                }
+            }
+        }
+        return true;
+    }
+
+    // pushes incoming bytes straight to the on_data callback of the socket until the socket
+    // would block; returns false if the connection is dead
+    [[nodiscard]] bool Reactor::EventLoop::process_readable_stream(Registration& registration) {
+        auto& buffer = registration.state->streaming_buffer;
+        while (true) {
+            buffer.resize(detail::streaming_chunk_length);
+            // clang-format off
+            auto const receive_result = recv(
+                registration.socket,
+                reinterpret_cast<char*>(buffer.data()),
+                static_cast<constants::SendReceiveSize>(buffer.size()),
+                0
+            );
+            // clang-format on
+            registration.state->num_receive_syscalls.fetch_add(1, std::memory_order_relaxed);
+
+            if (receive_result == constants::socket_error and last_operation_would_block()) {
+                // no more incoming data for now, try again on the next readiness notification
+                return true;
+            }
+
+            if (receive_result == 0 or receive_result == constants::socket_error) {
+                // connection has been gracefully closed or connection no longer active => the
+                // subscriber is informed via a final invocation with an empty span
+                registration.state->invoke_on_data({});
+                return false;
+            }
+
+            registration.state->num_bytes_received.fetch_add(
+                    static_cast<std::uint64_t>(receive_result),
+                    std::memory_order_relaxed
+            );
+            registration.state->invoke_on_data(std::span{ buffer.data(), static_cast<std::size_t>(receive_result) });
+        }
+    }
+
+    // reads stream data into the framing buffer of the socket until a complete frame can be
+    // extracted or the socket would block; returns false if the connection is dead
+    [[nodiscard]] bool Reactor::EventLoop::process_readable_frame(Registration& registration) {
+        auto& task = *registration.current_receive_task;
+        auto& framing_buffer = registration.state->framing_buffer;
+        while (true) {
+            // the incoming bytes are received directly into the tail of the framing buffer
+            auto const old_length = framing_buffer.size();
+            framing_buffer.resize(old_length + detail::frame_chunk_length);
+            // clang-format off
+            auto const receive_result = recv(
+                registration.socket,
+                reinterpret_cast<char*>(framing_buffer.data()) + old_length,
+                static_cast<constants::SendReceiveSize>(detail::frame_chunk_length),
+                0
+            );
+            // clang-format on
+            registration.state->num_receive_syscalls.fetch_add(1, std::memory_order_relaxed);
+
+            if (receive_result == constants::socket_error and last_operation_would_block()) {
+                // no more incoming data for now, try again on the next readiness notification
+                framing_buffer.resize(old_length);
+                return true;
+            }
+
+            if (receive_result == 0 or receive_result == constants::socket_error) {
+                // connection has been gracefully closed or connection no longer active => close socket
+                framing_buffer.resize(old_length);
+                task.promise.set_exception(std::make_exception_ptr(ReadError{}));
+                registration.current_receive_task.reset();
+                return false;
+            }
+
+            framing_buffer.resize(old_length + static_cast<std::size_t>(receive_result));
+            registration.state->num_bytes_received.fetch_add(
+                    static_cast<std::uint64_t>(receive_result),
+                    std::memory_order_relaxed
+            );
+
+            if (auto frame = detail::try_extract_frame(framing_buffer)) {
+                task.promise.set_value(*std::move(frame));
+                registration.current_receive_task.reset();
+                return true;
+            }
+        }
+    }
+
+    [[nodiscard]] bool Reactor::EventLoop::process_writable(Registration& registration) {
+        // a single writability notification may complete many queued send tasks: we keep writing
+        // until the socket would block or the send queue is drained
+        while (registration.current_send_task.has_value()) {
+            auto& task = *registration.current_send_task;
+            auto const num_bytes_remaining = task.data.size() - registration.num_bytes_sent;
+            // clang-format off
+            auto const result = ::send(
+                registration.socket,
+                reinterpret_cast<char const*>(task.data.data()) + registration.num_bytes_sent,
+                static_cast<constants::SendReceiveSize>(num_bytes_remaining),
+                constants::send_flags
+            );
+            // clang-format on
+            registration.state->num_send_syscalls.fetch_add(1, std::memory_order_relaxed);
+            if (result == constants::socket_error) {
+                if (last_operation_would_block()) {
+                    // the send buffer is full, try again on the next writability notification
+                    return true;
+                }
+                // connection no longer active
+                task.promise.set_value(0);
+                auto const num_queued_bytes = ClientSocket::State::queued_send_task_bytes(task);
+                registration.current_send_task.reset();
+                registration.state->shrink_send_queue(num_queued_bytes);
+                return false;
+            }
+            registration.num_bytes_sent += static_cast<std::size_t>(result);
+            registration.state->num_bytes_sent.fetch_add(static_cast<std::uint64_t>(result), std::memory_order_relaxed);
+            if (registration.num_bytes_sent == task.data.size()) {
+                if (task.file != nullptr and ClientSocket::refill_file_chunk(task)) {
+                    registration.num_bytes_sent = 0;
+                    continue;
+                }
+                task.promise.set_value(task.file != nullptr ? task.file_length : registration.num_bytes_sent);
+                auto const num_queued_bytes = ClientSocket::State::queued_send_task_bytes(task);
+                registration.current_send_task.reset();
+                registration.state->shrink_send_queue(num_queued_bytes);
+                registration.num_bytes_sent = 0;
+                if (not activate_next_send_task(registration)) {
+                    break;
+                }
+            }
+        }
+        return true;
+    }
+
+    void Reactor::EventLoop::abandon_tasks(Registration& registration) {
+        if (registration.current_send_task.has_value()) {
+            registration.current_send_task->promise.set_value(0);
+            auto const num_queued_bytes = ClientSocket::State::queued_send_task_bytes(*registration.current_send_task);
+            registration.current_send_task.reset();
+            registration.state->shrink_send_queue(num_queued_bytes);
+        }
+        if (registration.current_receive_task.has_value()) {
+            registration.current_receive_task->promise.set_value({});
+            registration.current_receive_task.reset();
+        }
+    }
+
+    void Reactor::EventLoop::run(std::stop_token const& stop_token) {
+        auto const wake_on_stop = std::stop_callback{ stop_token, [this] { m_wakeup.notify(); } };
+
+        auto file_descriptors = std::vector<PollFileDescriptor>{};
+        while (not stop_token.stop_requested()) {
+            // arming before the registration scan guarantees that tasks enqueued after the scan
+            // interrupt the upcoming poll via wake(), while earlier ones are picked up by the scan
+            m_poll_pending.store(true, std::memory_order_release);
+            file_descriptors.clear();
+            file_descriptors.push_back(
+                    PollFileDescriptor{ .fd = static_cast<decltype(PollFileDescriptor{}.fd)>(m_wakeup.read_handle()),
+                                        .events = POLLIN,
+                                        .revents = 0 }
+            );
+
+            auto next_deadline = std::optional<std::chrono::steady_clock::time_point>{};
+            // one clock sample serves all timeout checks of this cycle, so armed timeouts do
+            // not add a clock read per registration
+            auto const now = std::chrono::steady_clock::now();
+            m_registrations.apply([&](std::vector<std::unique_ptr<Registration>>& registrations) {
+                for (auto const& registration : registrations) {
+                    activate_tasks(*registration);
+                    handle_receive_timeout(*registration, now);
+
+                    auto events = decltype(PollFileDescriptor{}.events){ 0 };
+                    if (registration->state->has_on_data.load(std::memory_order_acquire)) {
+                        events |= POLLIN;
+                    }
+                    if (registration->current_receive_task.has_value()) {
+                        events |= POLLIN;
+                        auto const end_time = registration->current_receive_task->end_time;
+                        if (not next_deadline.has_value() or end_time < *next_deadline) {
+                            next_deadline = end_time;
+                        }
+                    }
+                    if (registration->current_send_task.has_value()) {
+                        events |= POLLOUT;
+                    }
+                    file_descriptors.push_back(
+                            PollFileDescriptor{ .fd = static_cast<decltype(PollFileDescriptor{}.fd)>(
+                                                        registration->socket
+                                                ),
+                                                .events = events,
+                                                .revents = 0 }
+                    );
+                }
+            });
+
+            auto const timeout_milliseconds = [&]() -> int {
+                if (not next_deadline.has_value()) {
+                    return -1; // wait indefinitely, the wakeup handle interrupts us when needed
+                }
+                auto const remaining = std::chrono::ceil<std::chrono::milliseconds>(
+                        *next_deadline - std::chrono::steady_clock::now()
+                );
+                return static_cast<int>(
+                        std::clamp<std::int64_t>(remaining.count(), 0, std::numeric_limits<int>::max())
+                );
+            }();
+
+            if (detail::poll_file_descriptors(file_descriptors.data(), file_descriptors.size(), timeout_milliseconds)
+                == constants::socket_error) {
+                advance_generation();
+                continue;
+            }
+            m_poll_pending.store(false, std::memory_order_relaxed);
+
+            if ((file_descriptors.front().revents & POLLIN) != 0) {
+                m_wakeup.clear();
+            }
+
+            m_registrations.apply([&](std::vector<std::unique_ptr<Registration>>& registrations) {
+                for (auto descriptor = file_descriptors.cbegin() + 1; descriptor != file_descriptors.cend();
+                     ++descriptor) {
+                    if (descriptor->revents == 0) {
+                        continue;
+                    }
+                    auto const iterator = std::find_if(
+                            registrations.begin(),
+                            registrations.end(),
+                            [&descriptor](std::unique_ptr<Registration> const& registration) {
+                                return static_cast<decltype(descriptor->fd)>(registration->socket) == descriptor->fd;
+                            }
+                    );
+                    if (iterator == registrations.end()) {
+                        // the socket has been removed while we were polling
+                        continue;
+                    }
+                    auto& registration = **iterator;
+                    if ((descriptor->revents & POLLIN) != 0) {
+                        if (not process_readable(registration)) {
+                            registration.is_dead = true;
+                            continue;
+                        }
+                    } else if ((descriptor->revents & (POLLERR | POLLHUP | POLLNVAL)) != 0) {
+                        registration.is_dead = true;
+                        continue;
+                    }
+                    if ((descriptor->revents & POLLOUT) != 0) {
+                        if (not process_writable(registration)) {
+                            registration.is_dead = true;
+                        }
+                    }
+                }
+
+                std::erase_if(registrations, [](std::unique_ptr<Registration> const& registration) {
+                    if (not registration->is_dead) {
+                        return false;
+                    }
+                    registration->state->stop_running();
+                    abandon_tasks(*registration);
+                    registration->state->clear_queues();
+                    return true;
+                });
+            });
+
+            advance_generation();
+        }
+
+        // fulfill all remaining promises so that no consumer blocks forever
+        m_registrations.apply([](std::vector<std::unique_ptr<Registration>>& registrations) {
+            for (auto const& registration : registrations) {
+                registration->state->stop_running();
+                abandon_tasks(*registration);
+                registration->state->clear_queues();
+            }
+            registrations.clear();
+        });
+
+        {
+            auto const lock = std::scoped_lock{ m_generation_mutex };
+            m_stopped = true;
+        }
+        m_generation_condition_variable.notify_all();
+    }
+} // namespace c2k
@@ -1,15 +1,28 @@
+#include "event_loop.hpp"
 #include "socket_headers.hpp"
+#ifdef __linux__
+#include <linux/errqueue.h>
+#include <sys/sendfile.h>
+#endif
 #include "sockets/detail/byte_order.hpp"
+#include "sockets/detail/wakeup.hpp"
 #include "sockets/sockets.hpp"
+#include <algorithm>
+#include <array>
 #include <cassert>
+#include <cerrno>
+#include <chrono>
 #include <cstring>
-#include <iomanip>
+#include <filesystem>
+#include <limits>
 #include <iostream>
 #include <lib2k/unreachable.hpp>
 #include <memory>
-#include <sstream>
 #include <stdexcept>
 #include <string>
+#include <thread>
+#include <tuple>
+#include <unordered_map>
 #include <utility>
 
 namespace c2k {
@@ -21,15 +34,22 @@ namespace c2k {
                 return AF_INET;
             case AddressFamily::Ipv6:
                 return AF_INET6;
+            case AddressFamily::Unix:
+                return AF_UNIX;
         }
         unreachable();
     }
 
-    [[nodiscard]] static constexpr addrinfo generate_hints(AddressFamily const address_family, bool const is_passive) {
+    // clang-format off
+    [[nodiscard]] static constexpr addrinfo generate_hints(
+        AddressFamily const address_family,
+        bool const is_passive,
+        bool const is_datagram
+    ) { // clang-format on
         auto hints = addrinfo{};
         hints.ai_family = to_ai_family(address_family);
-        hints.ai_socktype = SOCK_STREAM;
-        hints.ai_protocol = IPPROTO_TCP;
+        hints.ai_socktype = is_datagram ? SOCK_DGRAM : SOCK_STREAM;
+        hints.ai_protocol = is_datagram ? IPPROTO_UDP : IPPROTO_TCP;
         if (is_passive) {
             hints.ai_flags = AI_PASSIVE;
         }
@@ -85,11 +105,12 @@ namespace c2k {
     [[nodiscard]] static AddressInfos get_address_infos(
         AddressFamily const address_family,
         std::uint16_t const port,
-        char const* const host = nullptr
+        char const* const host = nullptr,
+        bool const is_datagram = false
     ) { // clang-format on
         auto const is_server = (host == nullptr);
 
-        auto const hints = generate_hints(address_family, is_server);
+        auto const hints = generate_hints(address_family, is_server, is_datagram);
 
         auto result = static_cast<addrinfo*>(nullptr);
         if (getaddrinfo(host, std::to_string(port).c_str(), &hints, &result) != 0) {
@@ -101,6 +122,87 @@ namespace c2k {
         return AddressInfos{ result };
     }
 
+    // a resolved endpoint holds a copy of the first getaddrinfo() result, so it can be cached
+    // beyond the lifetime of the owning AddressInfos (addrinfo chains are not copyable)
+    struct ResolvedEndpoint {
+        int family;
+        int socket_type;
+        int protocol;
+        sockaddr_storage address;
+        constants::SockLen address_length;
+    };
+
+    struct ResolverCacheEntry {
+        ResolvedEndpoint endpoint;
+        std::chrono::steady_clock::time_point expiry;
+    };
+
+    // getaddrinfo() has no portable way to report the record TTLs, so cached resolutions are
+    // kept for a fixed short interval; reconnect storms against the same few hosts skip the
+    // blocking resolver call entirely while address changes still propagate quickly
+    static constexpr auto resolver_cache_ttl = std::chrono::seconds{ 30 };
+
+    [[nodiscard]] static Synchronized<std::unordered_map<std::string, ResolverCacheEntry>>& resolver_cache() {
+        static auto cache = Synchronized<std::unordered_map<std::string, ResolverCacheEntry>>{
+            std::unordered_map<std::string, ResolverCacheEntry>{}
+        };
+        return cache;
+    }
+
+    // clang-format off
+    [[nodiscard]] static std::string resolver_cache_key(
+        AddressFamily const address_family,
+        std::string const& host,
+        std::uint16_t const port
+    ) { // clang-format on
+        return std::to_string(static_cast<int>(address_family)) + '|' + host + '|' + std::to_string(port);
+    }
+
+    static void invalidate_resolved_endpoint(std::string const& key) {
+        resolver_cache().apply([&key](std::unordered_map<std::string, ResolverCacheEntry>& cache) {
+            cache.erase(key);
+        });
+    }
+
+    // clang-format off
+    [[nodiscard]] static ResolvedEndpoint resolve_client_endpoint(
+        AddressFamily const address_family,
+        std::string const& host,
+        std::uint16_t const port
+    ) { // clang-format on
+        auto const key = resolver_cache_key(address_family, host, port);
+        auto const now = std::chrono::steady_clock::now();
+        auto const cached = resolver_cache().apply(
+                [&](std::unordered_map<std::string, ResolverCacheEntry> const& cache
+                ) -> std::optional<ResolvedEndpoint> {
+                    auto const iterator = cache.find(key);
+                    if (iterator == cache.end() or now >= iterator->second.expiry) {
+                        return std::nullopt;
+                    }
+                    return iterator->second.endpoint;
+                }
+        );
+        if (cached.has_value()) {
+            return *cached;
+        }
+        auto const address_infos = get_address_infos(address_family, port, host.c_str());
+        auto endpoint = ResolvedEndpoint{
+            .family = address_infos->ai_family,
+            .socket_type = address_infos->ai_socktype,
+            .protocol = address_infos->ai_protocol,
+            .address = {},
+            .address_length = static_cast<constants::SockLen>(address_infos->ai_addrlen),
+        };
+        std::memcpy(&endpoint.address, address_infos->ai_addr, address_infos->ai_addrlen);
+        resolver_cache().apply([&](std::unordered_map<std::string, ResolverCacheEntry>& cache) {
+            // expired entries are evicted on insertion, which bounds the cache size by the
+            // number of distinct endpoints dialed within one TTL interval
+            std::erase_if(cache, [now](auto const& pair) { return now >= pair.second.expiry; });
+            cache.insert_or_assign(key, ResolverCacheEntry{ endpoint, now + resolver_cache_ttl });
+        });
+        return endpoint;
+    }
+
     enum class SocketOption {
         TcpNoDelay,
         ReusePort,
@@ -147,20 +249,111 @@ namespace c2k {
         }
     }
 
-    static void set_all_default_socket_options(AbstractSocket::OsSocketHandle const socket) {
-        set_socket_option(socket, SocketOption::TcpNoDelay);
-        set_socket_option(socket, SocketOption::ReusePort);
+    // clang-format off
+    static void set_integer_socket_option(
+        AbstractSocket::OsSocketHandle const socket,
+        int const level,
+        int const option_name,
+        int const value,
+        char const* const description
+    ) { // clang-format on
+        auto const result =
+                ::setsockopt(socket, level, option_name, reinterpret_cast<char const*>(&value), sizeof(value));
+        if (result < 0) {
+            using namespace std::string_literals;
+            throw std::runtime_error{ "failed to set "s + description };
+        }
+    }
+
+    // the address family is passed in by the caller instead of being queried from the socket,
+    // since getsockname() fails for unbound sockets on Windows
+    static void apply_socket_options(
+            AbstractSocket::OsSocketHandle const socket,
+            int const address_family,
+            SocketOptions const& options
+    ) {
+        // TCP-level options (and the reuseport load balancing) are invalid for unix domain
+        // sockets; silently skipping them allows the same SocketOptions instance to be used
+        // for both transports
+        auto const is_internet_socket = (address_family == AF_INET or address_family == AF_INET6);
+        if (is_internet_socket) {
+            set_socket_option(socket, SocketOption::ReusePort);
+            if (options.tcp_no_delay) {
+                set_socket_option(socket, SocketOption::TcpNoDelay);
+            }
+            if (options.keep_alive) {
+                set_integer_socket_option(socket, SOL_SOCKET, SO_KEEPALIVE, 1, "KeepAlive");
+            }
+            if (options.quick_ack) {
+#ifdef TCP_QUICKACK
+                set_integer_socket_option(socket, IPPROTO_TCP, TCP_QUICKACK, 1, "QuickAck");
+#endif
+            }
+            if (options.zero_copy_send) {
+#ifdef SO_ZEROCOPY
+                set_integer_socket_option(socket, SOL_SOCKET, SO_ZEROCOPY, 1, "ZeroCopySend");
+#endif
+            }
+        }
+        static constexpr auto max_buffer_size = static_cast<std::size_t>(std::numeric_limits<int>::max());
+        if (options.receive_buffer_size > 0) {
+            auto const size = static_cast<int>(std::min(options.receive_buffer_size, max_buffer_size));
+            set_integer_socket_option(socket, SOL_SOCKET, SO_RCVBUF, size, "ReceiveBufferSize");
+        }
+        if (options.send_buffer_size > 0) {
+            auto const size = static_cast<int>(std::min(options.send_buffer_size, max_buffer_size));
+            set_integer_socket_option(socket, SOL_SOCKET, SO_SNDBUF, size, "SendBufferSize");
+        }
     }
 
-    [[nodiscard]] static AbstractSocket::OsSocketHandle create_socket(AddressInfos const& address_infos) {
+    // clang-format off
+    [[nodiscard]] static AbstractSocket::OsSocketHandle create_socket(
+        AddressInfos const& address_infos,
+        SocketOptions const& options = SocketOptions{}
+    ) { // clang-format on
         auto const socket = ::socket(address_infos->ai_family, address_infos->ai_socktype, address_infos->ai_protocol);
         if (socket == constants::invalid_socket) {
             throw std::runtime_error{ "failed to create socket" };
         }
-        set_all_default_socket_options(socket);
+        apply_socket_options(socket, address_infos->ai_family, options);
+        return socket;
+    }
+
+    // clang-format off
+    [[nodiscard]] static AbstractSocket::OsSocketHandle create_socket(
+        ResolvedEndpoint const& endpoint,
+        SocketOptions const& options = SocketOptions{}
+    ) { // clang-format on
+        auto const socket = ::socket(endpoint.family, endpoint.socket_type, endpoint.protocol);
+        if (socket == constants::invalid_socket) {
+            throw std::runtime_error{ "failed to create socket" };
+        }
+        apply_socket_options(socket, endpoint.family, options);
+        return socket;
+    }
+
+    [[nodiscard]] static AbstractSocket::OsSocketHandle create_unix_socket(
+            SocketOptions const& options = SocketOptions{}
+    ) {
+        auto const socket = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        if (socket == constants::invalid_socket) {
+            throw std::runtime_error{ "failed to create socket" };
+        }
+        apply_socket_options(socket, AF_UNIX, options);
         return socket;
     }
 
+    [[nodiscard]] static sockaddr_un to_unix_socket_address(std::filesystem::path const& path) {
+        auto const path_string = path.string();
+        auto address = sockaddr_un{};
+        address.sun_family = AF_UNIX;
+        if (path_string.length() >= sizeof(address.sun_path)) {
+            throw std::runtime_error{ "unix domain socket path is too long" };
+        }
+        std::memcpy(address.sun_path, path_string.c_str(), path_string.length() + 1);
+        return address;
+    }
+
     static void bind_socket(AbstractSocket::OsSocketHandle const socket, AddressInfos const& address_infos) {
         // clang-format off
         if (
@@ -180,47 +373,238 @@ namespace c2k {
         }
     }
 
+    static void connect_socket(AbstractSocket::OsSocketHandle const socket, ResolvedEndpoint const& endpoint) {
+        if (connect(socket, reinterpret_cast<sockaddr const*>(&endpoint.address), endpoint.address_length)
+            == constants::socket_error) {
+            closesocket(socket);
+            throw std::runtime_error{ "unable to connect" };
+        }
+    }
+
+    // clang-format off
+    static void connect_socket_with_timeout(
+        AbstractSocket::OsSocketHandle const socket,
+        ResolvedEndpoint const& endpoint,
+        std::chrono::steady_clock::duration const timeout
+    ) { // clang-format on
+        // a blocking connect can stall for the full TCP handshake timeout of the OS (tens of
+        // seconds against an unreachable host), so the connect is issued in non-blocking mode
+        // and its completion is awaited via a writability notification with our own deadline
+        detail::set_non_blocking(socket);
+        if (connect(socket, reinterpret_cast<sockaddr const*>(&endpoint.address), endpoint.address_length)
+            == constants::socket_error) {
+#ifdef _WIN32
+            auto const connect_in_progress = (WSAGetLastError() == WSAEWOULDBLOCK);
+#else
+            auto const connect_in_progress = (errno == EINPROGRESS);
+#endif
+            if (not connect_in_progress) {
+                closesocket(socket);
+                throw std::runtime_error{ "unable to connect" };
+            }
+            auto descriptor = detail::PollFileDescriptor{
+                .fd = static_cast<decltype(detail::PollFileDescriptor{}.fd)>(socket),
+                .events = POLLOUT,
+                .revents = 0,
+            };
+            auto const remaining = std::chrono::ceil<std::chrono::milliseconds>(timeout);
+            auto const timeout_milliseconds = static_cast<int>(
+                    std::clamp<std::int64_t>(remaining.count(), 0, std::numeric_limits<int>::max())
+            );
+            auto const poll_result = detail::poll_file_descriptors(&descriptor, 1, timeout_milliseconds);
+            if (poll_result == 0) {
+                closesocket(socket);
+                throw TimeoutError{};
+            }
+            auto error = 0;
+            auto length = static_cast<constants::SockLen>(sizeof(error));
+            // clang-format off
+            if (
+                poll_result == constants::socket_error
+                or getsockopt(socket, SOL_SOCKET, SO_ERROR, reinterpret_cast<char*>(&error), &length) != 0
+                or error != 0
+            ) { // clang-format on
+                closesocket(socket);
+                throw std::runtime_error{ "unable to connect" };
+            }
+        }
+        // the threaded send and receive paths expect a blocking socket (the reactor switches
+        // back to non-blocking mode itself when it takes over the socket)
+        detail::set_blocking(socket);
+    }
+
     static void socket_deleter(AbstractSocket::OsSocketHandle const handle) {
         closesocket(handle);
     }
 
+    // reclaims the per-socket resources of closed sockets on a single background thread, so
+    // that neither close() nor the destructor block on joining the send and receive threads
+    class SocketReaper final {
+    private:
+        using Task = std::move_only_function<void()>;
+
+        Synchronized<std::deque<Task>> m_tasks{ std::deque<Task>{} };
+        std::condition_variable_any m_task_enqueued_condition_variable;
+        std::jthread m_thread;
+
+    public:
+        SocketReaper() : m_thread{ [this](std::stop_token const& stop_token) { run(stop_token); } } { }
+
+        void enqueue(Task task) {
+            m_tasks.apply([&](std::deque<Task>& tasks) { tasks.push_back(std::move(task)); });
+            m_task_enqueued_condition_variable.notify_one();
+        }
+
+    private:
+        void run(std::stop_token const& stop_token) {
+            // locking the task queue before notifying prevents a lost wakeup (see
+            // ClientSocket::State::stop_running())
+            auto const wake_on_stop = std::stop_callback{ stop_token, [this] {
+                                                             m_tasks.apply([](std::deque<Task> const&) {});
+                                                             m_task_enqueued_condition_variable.notify_all();
+                                                         } };
+            while (true) {
+                m_tasks.wait(m_task_enqueued_condition_variable, [&](std::deque<Task> const& tasks) {
+                    return stop_token.stop_requested() or not tasks.empty();
+                });
+                auto task = detail::try_dequeue_task(m_tasks);
+                if (not task.has_value()) {
+                    if (stop_token.stop_requested()) {
+                        return; // all pending teardowns have been drained
+                    }
+                    continue;
+                }
+                (*task)();
+                // the captured resources are released here, on the reaper thread
+                task.reset();
+            }
+        }
+    };
+
+    [[nodiscard]] static SocketReaper& socket_reaper() {
+        static auto instance = SocketReaper{};
+        return instance;
+    }
+
+#ifdef _WIN32
+    detail::Wakeup::Wakeup() {
+        // Windows cannot poll on pipes, so we connect a pair of loopback sockets instead
+        auto const listener = ::socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+        if (listener == constants::invalid_socket) {
+            throw std::runtime_error{ "failed to create wakeup socket" };
+        }
+        auto address = sockaddr_in{};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = to_network_byte_order(std::uint32_t{ INADDR_LOOPBACK });
+        address.sin_port = 0;
+        auto address_length = static_cast<int>(sizeof(address));
+        // clang-format off
+        if (
+            bind(listener, reinterpret_cast<sockaddr const*>(&address), address_length) == constants::socket_error
+            or getsockname(listener, reinterpret_cast<sockaddr*>(&address), &address_length) == constants::socket_error
+            or listen(listener, 1) == constants::socket_error
+        ) { // clang-format on
+            closesocket(listener);
+            throw std::runtime_error{ "failed to set up wakeup socket" };
+        }
+        m_write_handle = ::socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+        if (m_write_handle == constants::invalid_socket
+            or connect(m_write_handle, reinterpret_cast<sockaddr const*>(&address), static_cast<int>(sizeof(address)))
+                       == constants::socket_error) {
+            if (m_write_handle != constants::invalid_socket) {
+                closesocket(m_write_handle);
+            }
+            closesocket(listener);
+            throw std::runtime_error{ "failed to connect wakeup socket" };
+        }
+        m_read_handle = accept(listener, nullptr, nullptr);
+        closesocket(listener);
+        if (m_read_handle == constants::invalid_socket) {
+            closesocket(m_write_handle);
+            throw std::runtime_error{ "failed to accept wakeup socket" };
+        }
+        for (auto const handle : { m_read_handle, m_write_handle }) {
+            auto non_blocking = u_long{ 1 };
+            if (ioctlsocket(handle, FIONBIO, &non_blocking) != 0) {
+                closesocket(m_read_handle);
+                closesocket(m_write_handle);
+                throw std::runtime_error{ "failed to set wakeup socket into non-blocking mode" };
+            }
+        }
+    }
+
+    detail::Wakeup::~Wakeup() {
+        closesocket(m_read_handle);
+        closesocket(m_write_handle);
+    }
+
+    void detail::Wakeup::notify() {
+        static constexpr char buffer = '\1';
+        // if the send buffer is full, a notification is already pending and we may ignore the error
+        std::ignore = ::send(m_write_handle, &buffer, 1, 0);
+    }
+
+    void detail::Wakeup::clear() {
+        char buffer[64];
+        while (recv(m_read_handle, buffer, sizeof(buffer), 0) > 0) { }
+    }
+#else
+    detail::Wakeup::Wakeup() {
+        int file_descriptors[2];
+        if (::pipe(file_descriptors) != 0) {
+            throw std::runtime_error{ "failed to create wakeup pipe" };
+        }
+        m_read_handle = file_descriptors[0];
+        m_write_handle = file_descriptors[1];
+        for (auto const file_descriptor : file_descriptors) {
+            auto const flags = fcntl(file_descriptor, F_GETFL, 0);
+            if (flags == -1 or fcntl(file_descriptor, F_SETFL, flags | O_NONBLOCK) == -1) {
+                ::close(m_read_handle);
+                ::close(m_write_handle);
+                throw std::runtime_error{ "failed to set wakeup pipe into non-blocking mode" };
+            }
+        }
+    }
+
+    detail::Wakeup::~Wakeup() {
+        ::close(m_read_handle);
+        ::close(m_write_handle);
+    }
+
+    void detail::Wakeup::notify() {
+        static constexpr char buffer = '\1';
+        // if the pipe is full, a notification is already pending and we may ignore the error
+        std::ignore = ::write(m_write_handle, &buffer, 1);
+    }
+
+    void detail::Wakeup::clear() {
+        char buffer[64];
+        while (::read(m_read_handle, buffer, sizeof(buffer)) > 0) { }
+    }
+#endif
+
 #ifdef _WIN32
     [[nodiscard]] static AddressInfo extract_adress_info(SOCKADDR_STORAGE const& address) {
         switch (address.ss_family) {
             case AF_INET: {
                 auto const ipv4_info = reinterpret_cast<sockaddr_in const*>(&address);
-                auto ipv4_address = std::to_string(ipv4_info->sin_addr.S_un.S_un_b.s_b1) + "."
-                                    + std::to_string(ipv4_info->sin_addr.S_un.S_un_b.s_b2) + "."
-                                    + std::to_string(ipv4_info->sin_addr.S_un.S_un_b.s_b3) + "."
-                                    + std::to_string(ipv4_info->sin_addr.S_un.S_un_b.s_b4);
+                auto raw_address = std::array<std::byte, 16>{};
+                std::memcpy(raw_address.data(), &ipv4_info->sin_addr, 4);
                 return AddressInfo{ AddressFamily::Ipv4,
-                                    std::move(ipv4_address),
+                                    raw_address,
                                     from_network_byte_order(static_cast<std::uint16_t>(ipv4_info->sin_port)) };
             }
             case AF_INET6: {
                 auto const ipv6_info = reinterpret_cast<sockaddr_in6 const*>(&address);
-                auto stream = std::stringstream{};
-                stream << std::hex << std::setfill('0');
-                stream << std::setw(2) << ipv6_info->sin6_addr.u.Byte[0] << std::setw(2)
-                       << ipv6_info->sin6_addr.u.Byte[1] << ':';
-                stream << std::setw(2) << ipv6_info->sin6_addr.u.Byte[2] << std::setw(2)
-                       << ipv6_info->sin6_addr.u.Byte[3] << ':';
-                stream << std::setw(2) << ipv6_info->sin6_addr.u.Byte[4] << std::setw(2)
-                       << ipv6_info->sin6_addr.u.Byte[5] << ':';
-                stream << std::setw(2) << ipv6_info->sin6_addr.u.Byte[6] << std::setw(2)
-                       << ipv6_info->sin6_addr.u.Byte[7] << ':';
-                stream << std::setw(2) << ipv6_info->sin6_addr.u.Byte[8] << std::setw(2)
-                       << ipv6_info->sin6_addr.u.Byte[9] << ':';
-                stream << std::setw(2) << ipv6_info->sin6_addr.u.Byte[10] << std::setw(2)
-                       << ipv6_info->sin6_addr.u.Byte[11] << ':';
-                stream << std::setw(2) << ipv6_info->sin6_addr.u.Byte[12] << std::setw(2)
-                       << ipv6_info->sin6_addr.u.Byte[13] << ':';
-                stream << std::setw(2) << ipv6_info->sin6_addr.u.Byte[14] << std::setw(2)
-                       << ipv6_info->sin6_addr.u.Byte[15];
+                auto raw_address = std::array<std::byte, 16>{};
+                std::memcpy(raw_address.data(), &ipv6_info->sin6_addr, 16);
                 return AddressInfo{ AddressFamily::Ipv6,
-                                    std::move(stream).str(),
+                                    raw_address,
                                     from_network_byte_order(static_cast<std::uint16_t>(ipv6_info->sin6_port)) };
             }
+            case AF_UNIX:
+                // the socket path is not part of the AddressInfo; the entry only records the family
+                return AddressInfo{ AddressFamily::Unix, {}, 0 };
         }
         unreachable();
     }
@@ -229,40 +613,23 @@ namespace c2k {
         switch (address.ss_family) {
             case AF_INET: {
                 auto const ipv4_info = reinterpret_cast<sockaddr_in const*>(&address);
-                auto const ipv4_address_32 = from_network_byte_order(ipv4_info->sin_addr.s_addr);
-                static_assert(sizeof(ipv4_address_32) == 4);
-                auto ipv4_address = std::to_string((ipv4_address_32 >> 24) & 0xFF) + "."
-                                    + std::to_string((ipv4_address_32 >> 16) & 0xFF) + "."
-                                    + std::to_string((ipv4_address_32 >> 8) & 0xFF) + "."
-                                    + std::to_string((ipv4_address_32 >> 0) & 0xFF);
+                auto raw_address = std::array<std::byte, 16>{};
+                std::memcpy(raw_address.data(), &ipv4_info->sin_addr, 4);
                 return AddressInfo{ AddressFamily::Ipv4,
-                                    std::move(ipv4_address),
+                                    raw_address,
                                     from_network_byte_order(static_cast<std::uint16_t>(ipv4_info->sin_port)) };
             }
             case AF_INET6: {
                 auto const ipv6_info = reinterpret_cast<sockaddr_in6 const*>(&address);
-                auto stream = std::stringstream{};
-                stream << std::hex << std::setfill('0');
-                stream << std::setw(2) << ipv6_info->sin6_addr.s6_addr[0] << std::setw(2)
-                       << ipv6_info->sin6_addr.s6_addr[1] << ':';
-                stream << std::setw(2) << ipv6_info->sin6_addr.s6_addr[2] << std::setw(2)
-                       << ipv6_info->sin6_addr.s6_addr[3] << ':';
-                stream << std::setw(2) << ipv6_info->sin6_addr.s6_addr[4] << std::setw(2)
-                       << ipv6_info->sin6_addr.s6_addr[5] << ':';
-                stream << std::setw(2) << ipv6_info->sin6_addr.s6_addr[6] << std::setw(2)
-                       << ipv6_info->sin6_addr.s6_addr[7] << ':';
-                stream << std::setw(2) << ipv6_info->sin6_addr.s6_addr[8] << std::setw(2)
-                       << ipv6_info->sin6_addr.s6_addr[9] << ':';
-                stream << std::setw(2) << ipv6_info->sin6_addr.s6_addr[10] << std::setw(2)
-                       << ipv6_info->sin6_addr.s6_addr[11] << ':';
-                stream << std::setw(2) << ipv6_info->sin6_addr.s6_addr[12] << std::setw(2)
-                       << ipv6_info->sin6_addr.s6_addr[13] << ':';
-                stream << std::setw(2) << ipv6_info->sin6_addr.s6_addr[14] << std::setw(2)
-                       << ipv6_info->sin6_addr.s6_addr[15];
+                auto raw_address = std::array<std::byte, 16>{};
+                std::memcpy(raw_address.data(), &ipv6_info->sin6_addr, 16);
                 return AddressInfo{ AddressFamily::Ipv6,
-                                    std::move(stream).str(),
+                                    raw_address,
                                     from_network_byte_order(static_cast<std::uint16_t>(ipv6_info->sin6_port)) };
             }
+            case AF_UNIX:
+                // the socket path is not part of the AddressInfo; the entry only records the family
+                return AddressInfo{ AddressFamily::Unix, {}, 0 };
         }
         unreachable();
     }
@@ -313,51 +680,328 @@ namespace c2k {
     }
     // clang-format on
 
-    [[nodiscard]] static auto
-    initialize_client_socket(AddressFamily const address_family, std::string const& host, std::uint16_t const port) {
-        auto const address_infos = get_address_infos(address_family, port, host.c_str());
-        auto const socket = create_socket(address_infos);
-        connect_socket(socket, address_infos);
+    [[nodiscard]] static AbstractSocket::OsSocketHandle initialize_unix_server_socket(
+            std::filesystem::path const& path
+    ) {
+        auto const address = to_unix_socket_address(path);
+        // a socket file left behind by a previous run would otherwise make bind() fail
+        auto error = std::error_code{};
+        if (std::filesystem::is_socket(path, error)) {
+            std::filesystem::remove(path, error);
+        }
+        auto const socket = create_unix_socket();
+        // clang-format off
+        if (
+            bind(socket, reinterpret_cast<sockaddr const*>(&address), static_cast<constants::SockLen>(sizeof(address)))
+            == constants::socket_error
+        ) { // clang-format on
+            closesocket(socket);
+            throw std::runtime_error{ "failed to bind socket" };
+        }
+        return socket;
+    }
+
+    namespace detail {
+        // clang-format off
+        [[nodiscard]] AbstractSocket::OsSocketHandle initialize_udp_socket(
+            AddressFamily const address_family,
+            std::uint16_t const port,
+            char const* const host
+        ) { // clang-format on
+            auto const address_infos = get_address_infos(address_family, port, host, true);
+            // create_socket would also set TcpNoDelay, which is invalid for datagram sockets
+            auto const socket =
+                    ::socket(address_infos->ai_family, address_infos->ai_socktype, address_infos->ai_protocol);
+            if (socket == constants::invalid_socket) {
+                throw std::runtime_error{ "failed to create socket" };
+            }
+            set_socket_option(socket, SocketOption::ReusePort);
+            if (host == nullptr) {
+                bind_socket(socket, address_infos);
+            } else {
+                connect_socket(socket, address_infos);
+            }
+            return socket;
+        }
+        [[nodiscard]] std::optional<std::vector<std::byte>> try_extract_frame(std::vector<std::byte>& stream) {
+            if (stream.size() < frame_header_length) {
+                return std::nullopt;
+            }
+            auto payload_length = std::uint32_t{ 0 };
+            for (auto i = std::size_t{ 0 }; i < frame_header_length; ++i) {
+                payload_length = (payload_length << 8) | std::to_integer<std::uint32_t>(stream[i]);
+            }
+            auto const frame_length = frame_header_length + payload_length;
+            if (stream.size() < frame_length) {
+                return std::nullopt;
+            }
+            auto const frame_end = stream.begin() + static_cast<std::ptrdiff_t>(frame_length);
+            auto payload = std::vector<std::byte>{ stream.begin() + frame_header_length, frame_end };
+            stream.erase(stream.begin(), frame_end);
+            return payload;
+        }
+    } // namespace detail
+
+    // clang-format off
+    [[nodiscard]] static auto initialize_client_socket(
+        AddressFamily const address_family,
+        std::string const& host,
+        std::uint16_t const port,
+        SocketOptions const& options = SocketOptions{}
+    ) { // clang-format on
+        auto const endpoint = resolve_client_endpoint(address_family, host, port);
+        auto const socket = create_socket(endpoint, options);
+        try {
+            connect_socket(socket, endpoint);
+        } catch (...) {
+            // a stale cache entry must not poison subsequent reconnect attempts
+            invalidate_resolved_endpoint(resolver_cache_key(address_family, host, port));
+            throw;
+        }
+        return socket;
+    }
+
+    // clang-format off
+    [[nodiscard]] static auto initialize_client_socket(
+        AddressFamily const address_family,
+        std::string const& host,
+        std::uint16_t const port,
+        std::chrono::steady_clock::duration const timeout,
+        SocketOptions const& options = SocketOptions{}
+    ) { // clang-format on
+        auto const endpoint = resolve_client_endpoint(address_family, host, port);
+        auto const socket = create_socket(endpoint, options);
+        try {
+            connect_socket_with_timeout(socket, endpoint, timeout);
+        } catch (...) {
+            // a stale cache entry must not poison subsequent reconnect attempts
+            invalidate_resolved_endpoint(resolver_cache_key(address_family, host, port));
+            throw;
+        }
+        return socket;
+    }
+
+    // clang-format off
+    [[nodiscard]] static auto initialize_unix_client_socket(
+        std::filesystem::path const& path,
+        SocketOptions const& options = SocketOptions{}
+    ) { // clang-format on
+        auto const address = to_unix_socket_address(path);
+        auto const socket = create_unix_socket(options);
+        // clang-format off
+        if (
+            connect(
+                socket,
+                reinterpret_cast<sockaddr const*>(&address),
+                static_cast<constants::SockLen>(sizeof(address))
+            )
+            == constants::socket_error
+        ) { // clang-format on
+            closesocket(socket);
+            throw std::runtime_error{ "unable to connect" };
+        }
         return socket;
     }
 
     void server_listen(
             std::stop_token const& stop_token,
             AbstractSocket::OsSocketHandle const listen_socket,
-            std::function<void(ClientSocket)> const& on_connect
+            std::function<void(ClientSocket)> const& on_connect,
+            SocketOptions const& options,
+            Reactor* const reactor,
+            std::atomic_uint64_t* const num_connections_accepted
     ) {
+        using OsSocketHandle = AbstractSocket::OsSocketHandle;
+
+        // the listen socket is non-blocking so that a single readiness wakeup allows us to
+        // drain the whole accept backlog instead of accepting one connection per wakeup
+        detail::set_non_blocking(listen_socket);
+
+        // accepted sockets share the listen socket's address family, which determines the
+        // applicable socket options (the listen socket is bound, so getsockname() is valid
+        // here even on Windows, where it fails for unbound sockets)
+        auto listen_address = sockaddr_storage{};
+        auto listen_address_length = static_cast<constants::SockLen>(sizeof(listen_address));
+        // clang-format off
+        if (
+            getsockname(listen_socket, reinterpret_cast<sockaddr*>(&listen_address), &listen_address_length)
+            == constants::socket_error
+        ) { // clang-format on
+            throw std::runtime_error{ "failed to determine socket address family" };
+        }
+        auto const address_family = static_cast<int>(listen_address.ss_family);
+
+        auto pending_clients = Synchronized<std::deque<OsSocketHandle>>{ std::deque<OsSocketHandle>{} };
+        auto client_accepted_condition_variable = std::condition_variable_any{};
+
+        // the per-connection setup (socket options, address queries, spawning the worker
+        // threads or registering with an event loop) and the connect callback itself are
+        // expensive compared to accept(); they run on separate dispatch threads so that the
+        // accept loop gets back to accepting as quickly as possible
+        auto const dispatch = [&](std::stop_token const& dispatch_stop_token) {
+            while (true) {
+                pending_clients.wait(
+                        client_accepted_condition_variable,
+                        [&dispatch_stop_token](std::deque<OsSocketHandle> const& handles) {
+                            return dispatch_stop_token.stop_requested() or not handles.empty();
+                        }
+                );
+                if (dispatch_stop_token.stop_requested()) {
+                    // the server is shutting down => close all connections that have been
+                    // accepted but not dispatched yet
+                    for (auto const handle : detail::drain_tasks(pending_clients)) {
+                        closesocket(handle);
+                    }
+                    return;
+                }
+                auto const handle = detail::try_dequeue_task(pending_clients);
+                if (not handle.has_value()) {
+                    continue;
+                }
+                apply_socket_options(handle.value(), address_family, options);
+                auto client = reactor == nullptr ? ClientSocket{ handle.value() }
+                                                 : ClientSocket{ handle.value(), *reactor };
+                client.configure_send_queue(options);
+                on_connect(std::move(client));
+            }
+        };
+
+        // with more than one dispatch thread a slow connect callback only delays its own
+        // connection; the remaining threads keep pulling from the shared queue
+        auto dispatch_threads = std::vector<std::jthread>{};
+        dispatch_threads.reserve(std::max(options.num_connect_callback_threads, std::size_t{ 1 }));
+        for (auto i = std::size_t{ 0 }; i < std::max(options.num_connect_callback_threads, std::size_t{ 1 }); ++i) {
+            dispatch_threads.emplace_back(dispatch);
+        }
+
         while (not stop_token.stop_requested()) {
             auto const can_accept = is_socket_ready(listen_socket, SelectStatusCategory::Read, 100);
             if (not can_accept) {
                 continue;
             }
 
-            auto const client_socket = accept(listen_socket, nullptr, nullptr);
-            // clang-format off
-            assert(
-                client_socket != constants::invalid_socket
-                and "successful acceptance is guaranteed by previous call to select"
-            );
-            // clang-format on
-
-            set_all_default_socket_options(client_socket);
+            auto accepted_any = false;
+            while (true) {
+                auto const client_socket = accept(listen_socket, nullptr, nullptr);
+                if (client_socket == constants::invalid_socket) {
+                    // the backlog is drained (or the connection vanished in the meantime)
+                    break;
+                }
+                pending_clients.apply([client_socket](std::deque<OsSocketHandle>& handles) {
+                    handles.push_back(client_socket);
+                });
+                num_connections_accepted->fetch_add(1, std::memory_order_relaxed);
+                accepted_any = true;
+            }
+            if (accepted_any) {
+                // a whole accepted batch may need several dispatch threads at once
+                client_accepted_condition_variable.notify_all();
+            }
+        }
 
-            on_connect(ClientSocket{ client_socket });
+        for (auto& dispatch_thread : dispatch_threads) {
+            dispatch_thread.request_stop();
         }
+        // locking the queue guarantees that every dispatch thread either has not evaluated its
+        // wait predicate yet or is already waiting, so the notification cannot get lost
+        pending_clients.apply([](std::deque<OsSocketHandle> const&) {});
+        client_accepted_condition_variable.notify_all();
     }
 
     ServerSocket::ServerSocket(
             AddressFamily const address_family,
             std::uint16_t const port,
             std::function<void(ClientSocket)> on_connect
+    )
+        : ServerSocket{ address_family, port, std::move(on_connect), 1, nullptr } {}
+
+    ServerSocket::ServerSocket(
+            AddressFamily const address_family,
+            std::uint16_t const port,
+            std::function<void(ClientSocket)> on_connect,
+            Reactor& reactor
+    )
+        : ServerSocket{ address_family, port, std::move(on_connect), 1, &reactor } {}
+
+    ServerSocket::ServerSocket(
+            AddressFamily const address_family,
+            std::uint16_t const port,
+            std::function<void(ClientSocket)> on_connect,
+            std::size_t const num_acceptors,
+            Reactor* const reactor,
+            SocketOptions const& options
     )
         : AbstractSocket{ initialize_server_socket(address_family, port) } {
+        if (num_acceptors == 0) {
+            throw std::runtime_error{ "a server socket requires at least one acceptor" };
+        }
+        assert(m_socket_descriptor.has_value() and "has been set via parent constructor");
+        if (listen(m_socket_descriptor.value(), SOMAXCONN) == constants::socket_error) {
+            throw std::runtime_error{ "failed to listen on socket" };
+        }
+
+        m_num_connections_accepted = std::make_shared<std::atomic_uint64_t>(0);
+
+        // all acceptor threads share the same callback instance
+        auto const shared_on_connect = std::make_shared<std::function<void(ClientSocket)> const>(std::move(on_connect));
+        auto const counter = m_num_connections_accepted;
+        auto const make_listen_thread =
+                [shared_on_connect, options, reactor, counter](AbstractSocket::OsSocketHandle const socket) {
+                    return std::jthread{
+                        [socket, shared_on_connect, options, reactor, counter](std::stop_token const& stop_token) {
+                            server_listen(stop_token, socket, *shared_on_connect, options, reactor, counter.get());
+                        }
+                    };
+                };
+
+        m_listen_thread = make_listen_thread(m_socket_descriptor.value());
+
+        // since all default socket options include reuse_port, further listen sockets can be
+        // bound to the very same port (which has been resolved by now, even if it was passed
+        // as 0) and the kernel distributes incoming connections across all of them
+        auto const resolved_port = local_address().port;
+        m_additional_acceptors.reserve(num_acceptors - 1);
+        for (auto i = std::size_t{ 1 }; i < num_acceptors; ++i) {
+            auto const acceptor_socket = initialize_server_socket(address_family, resolved_port);
+            if (listen(acceptor_socket, SOMAXCONN) == constants::socket_error) {
+                closesocket(acceptor_socket);
+                throw std::runtime_error{ "failed to listen on socket" };
+            }
+            m_additional_acceptors.push_back(Acceptor{
+                    UniqueValue<OsSocketHandle, void (*)(OsSocketHandle)>{ acceptor_socket, socket_deleter },
+                    make_listen_thread(acceptor_socket),
+            });
+        }
+    }
+
+    ServerSocket::ServerSocket(
+            std::filesystem::path const& path,
+            std::function<void(ClientSocket)> on_connect,
+            Reactor* const reactor,
+            SocketOptions const& options
+    )
+        : AbstractSocket{ initialize_unix_server_socket(path) },
+          m_unix_socket_path{ path } {
         assert(m_socket_descriptor.has_value() and "has been set via parent constructor");
         if (listen(m_socket_descriptor.value(), SOMAXCONN) == constants::socket_error) {
             throw std::runtime_error{ "failed to listen on socket" };
         }
 
-        m_listen_thread = std::jthread{ server_listen, m_socket_descriptor.value(), std::move(on_connect) };
+        m_num_connections_accepted = std::make_shared<std::atomic_uint64_t>(0);
+
+        // unlike the TCP constructor, there is only a single acceptor, since reuseport load
+        // balancing does not apply to unix domain sockets
+        auto const shared_on_connect = std::make_shared<std::function<void(ClientSocket)> const>(std::move(on_connect));
+        auto const counter = m_num_connections_accepted;
+        m_listen_thread = std::jthread{
+            [socket = m_socket_descriptor.value(),
+             shared_on_connect,
+             options,
+             reactor,
+             counter](std::stop_token const& stop_token) {
+                server_listen(stop_token, socket, *shared_on_connect, options, reactor, counter.get());
+            }
+        };
     }
 
     ServerSocket::~ServerSocket() {
@@ -366,6 +1010,14 @@ namespace c2k {
 
     void ServerSocket::stop() {
         m_listen_thread.request_stop();
+        for (auto& acceptor : m_additional_acceptors) {
+            acceptor.listen_thread.request_stop();
+        }
+        if (not m_unix_socket_path.empty()) {
+            // the socket file would otherwise outlive the server and shadow the next bind()
+            auto error = std::error_code{};
+            std::filesystem::remove(m_unix_socket_path, error);
+        }
     }
 
     void ClientSocket::State::clear_queues() {
@@ -376,62 +1028,235 @@ namespace c2k {
                 task.promise.set_value({});
             }
         });
-        send_tasks.apply([](std::deque<SendTask>& tasks) {
+        send_tasks.apply([this](std::deque<SendTask>& tasks) {
             while (not tasks.empty()) {
                 auto task = std::move(tasks.front());
                 tasks.pop_front();
                 task.promise.set_value(0);
             }
+            send_queue_bytes.store(0, std::memory_order_relaxed);
         });
+        send_queue_shrunk_condition_variable.notify_all();
     }
 
-    ClientSocket::ClientSocket(OsSocketHandle const os_socket_handle)
-        : AbstractSocket{ os_socket_handle },
-          m_send_thread{ keep_sending, std::ref(*m_shared_state), m_socket_descriptor.value() },
-          m_receive_thread{ keep_receiving, std::ref(*m_shared_state), m_socket_descriptor.value() } { }
-
-    ClientSocket::ClientSocket(AddressFamily const address_family, std::string const& host, std::uint16_t const port)
-        : ClientSocket{ initialize_client_socket(address_family, host, port) } { }
-
-    template<typename Queue, typename Element = typename Queue::value_type>
-    [[nodiscard]] static std::optional<Element> try_dequeue_task(Synchronized<Queue>& queue) {
-        return queue.apply([](Queue& tasks) -> std::optional<Element> {
-            if (tasks.empty()) {
-                return std::nullopt;
+    void ClientSocket::State::shrink_send_queue(std::size_t const num_bytes) {
+        auto const queue_has_drained = send_tasks.apply([&](std::deque<SendTask> const&) {
+            send_queue_bytes.fetch_sub(num_bytes, std::memory_order_relaxed);
+            if (not send_queue_reached_watermark) {
+                return false;
+            }
+            auto const remaining = send_queue_bytes.load(std::memory_order_relaxed);
+            if (remaining <= max_send_queue_bytes / 2) {
+                send_queue_reached_watermark = false;
+                return true;
             }
-            auto result = std::move(tasks.front());
-            tasks.pop_front();
-            return result;
+            return false;
         });
-    }
-
+        if (max_send_queue_bytes > 0) {
+            send_queue_shrunk_condition_variable.notify_all();
+        }
+        if (queue_has_drained and has_on_writable.load(std::memory_order_acquire)) {
+            on_writable.apply([](std::function<void()> const& callback) {
+                if (callback) {
+                    callback();
+                }
+            });
+        }
+    }
+
+    [[nodiscard]] bool ClientSocket::State::make_room_in_send_queue(std::size_t const num_incoming_bytes) {
+        if (max_send_queue_bytes == 0 or num_incoming_bytes == 0) {
+            return true;
+        }
+        switch (send_queue_policy) {
+            case SendQueuePolicy::Block:
+                // an empty queue always accepts the data, so that a single payload bigger than
+                // the limit cannot deadlock the caller
+                send_tasks.wait(send_queue_shrunk_condition_variable, [&](std::deque<SendTask> const& tasks) {
+                    return not is_running() or tasks.empty()
+                           or send_queue_bytes.load(std::memory_order_relaxed) + num_incoming_bytes
+                                      <= max_send_queue_bytes;
+                });
+                return true;
+            case SendQueuePolicy::Fail:
+                return send_tasks.apply([&](std::deque<SendTask> const& tasks) {
+                    return tasks.empty()
+                           or send_queue_bytes.load(std::memory_order_relaxed) + num_incoming_bytes
+                                      <= max_send_queue_bytes;
+                });
+            case SendQueuePolicy::DropOldest:
+                send_tasks.apply([&](std::deque<SendTask>& tasks) {
+                    while (not tasks.empty()
+                           and send_queue_bytes.load(std::memory_order_relaxed) + num_incoming_bytes
+                                       > max_send_queue_bytes) {
+                        auto task = std::move(tasks.front());
+                        tasks.pop_front();
+                        send_queue_bytes.fetch_sub(queued_send_task_bytes(task), std::memory_order_relaxed);
+                        task.promise.set_value(0);
+                    }
+                });
+                return true;
+        }
+        unreachable();
+    }
+
+    ClientSocket::ClientSocket(OsSocketHandle const os_socket_handle)
+        : AbstractSocket{ os_socket_handle },
+          m_shared_state{ std::make_shared<State>(true) },
+          m_send_thread{ keep_sending, std::ref(*m_shared_state), m_socket_descriptor.value() },
+          m_receive_thread{ keep_receiving, std::ref(*m_shared_state), m_socket_descriptor.value() } { }
+
+    ClientSocket::ClientSocket(OsSocketHandle const os_socket_handle, Reactor& reactor)
+        : AbstractSocket{ os_socket_handle },
+          m_shared_state{ std::make_shared<State>(false) },
+          m_event_loop{ &reactor.next_event_loop() } {
+        m_event_loop->add_client(m_socket_descriptor.value(), *m_shared_state);
+    }
+
+    ClientSocket::ClientSocket(AddressFamily const address_family, std::string const& host, std::uint16_t const port)
+        : ClientSocket{ initialize_client_socket(address_family, host, port) } { }
+
+    // clang-format off
+    ClientSocket::ClientSocket(
+        AddressFamily const address_family,
+        std::string const& host,
+        std::uint16_t const port,
+        Reactor& reactor
+    )
+        : ClientSocket{ initialize_client_socket(address_family, host, port), reactor } { }
+
+    ClientSocket::ClientSocket(
+        AddressFamily const address_family,
+        std::string const& host,
+        std::uint16_t const port,
+        SocketOptions const& options
+    )
+        : ClientSocket{ initialize_client_socket(address_family, host, port, options) } {
+        configure_send_queue(options);
+    }
+
+    ClientSocket::ClientSocket(
+        AddressFamily const address_family,
+        std::string const& host,
+        std::uint16_t const port,
+        SocketOptions const& options,
+        Reactor& reactor
+    )
+        : ClientSocket{ initialize_client_socket(address_family, host, port, options), reactor } {
+        configure_send_queue(options);
+    }
+
+    ClientSocket::ClientSocket(
+        AddressFamily const address_family,
+        std::string const& host,
+        std::uint16_t const port,
+        Timeout const timeout
+    )
+        : ClientSocket{ initialize_client_socket(address_family, host, port, timeout) } { }
+
+    ClientSocket::ClientSocket(
+        AddressFamily const address_family,
+        std::string const& host,
+        std::uint16_t const port,
+        Timeout const timeout,
+        Reactor& reactor
+    )
+        : ClientSocket{ initialize_client_socket(address_family, host, port, timeout), reactor } { }
+
+    ClientSocket::ClientSocket(std::filesystem::path const& path)
+        : ClientSocket{ initialize_unix_client_socket(path) } { }
+
+    ClientSocket::ClientSocket(std::filesystem::path const& path, Reactor& reactor)
+        : ClientSocket{ initialize_unix_client_socket(path), reactor } { }
+
+    ClientSocket::ClientSocket(std::filesystem::path const& path, SocketOptions const& options)
+        : ClientSocket{ initialize_unix_client_socket(path, options) } {
+        configure_send_queue(options);
+    }
+
+    ClientSocket::ClientSocket(
+        std::filesystem::path const& path,
+        SocketOptions const& options,
+        Reactor& reactor
+    )
+        : ClientSocket{ initialize_unix_client_socket(path, options), reactor } {
+        configure_send_queue(options);
+    }
+    // clang-format on
+
     void ClientSocket::keep_sending(State& state, OsSocketHandle const socket) {
+#ifdef SO_ZEROCOPY
+        {
+            // zero-copy transmission is opt-in via SocketOptions; querying the socket here
+            // avoids threading the options through every constructor
+            auto flag = 0;
+            auto length = static_cast<constants::SockLen>(sizeof(flag));
+            if (getsockopt(socket, SOL_SOCKET, SO_ZEROCOPY, reinterpret_cast<char*>(&flag), &length) == 0) {
+                state.zero_copy_enabled = (flag != 0);
+            }
+        }
+#endif
         while (state.is_running()) {
-            auto processed_send_task = false;
-            if (auto send_task = try_dequeue_task(state.send_tasks)) {
-                processed_send_task = true;
-                if (not process_send_task(socket, *std::move(send_task))) {
+            // drain the whole queue at once so that all queued messages can be written with a
+            // single gather syscall instead of one send per task
+            if (auto send_tasks = detail::drain_tasks(state.send_tasks); not send_tasks.empty()) {
+                auto num_batch_bytes = std::size_t{ 0 };
+                for (auto const& task : send_tasks) {
+                    num_batch_bytes += State::queued_send_task_bytes(task);
+                }
+
+                // opt-in Nagle-like batching: give trickling small writes a short, bounded
+                // window to pile up, so they leave in one gather syscall (and thus fewer
+                // packets) instead of one packet each; batches that already amortize the
+                // syscall are sent right away
+                if (state.send_coalescing_window > std::chrono::microseconds::zero()
+                    and num_batch_bytes < detail::send_coalescing_size_budget and state.is_running()) {
+                    std::this_thread::sleep_for(state.send_coalescing_window);
+                    for (auto& task : detail::drain_tasks(state.send_tasks)) {
+                        num_batch_bytes += State::queued_send_task_bytes(task);
+                        send_tasks.push_back(std::move(task));
+                    }
+                }
+
+                // the batch counts against the queue limit until it has been fully processed,
+                // otherwise blocked producers could refill the queue while gigabytes of drained
+                // payloads are still alive in this batch
+                auto const success = process_send_tasks(state, socket, std::move(send_tasks));
+                state.shrink_send_queue(num_batch_bytes);
+                if (not success) {
                     // connection is dead
                     state.stop_running();
                     break;
                 }
+                continue;
             }
 
-            if (not processed_send_task) {
-                state.send_tasks.wait(state.data_sent_condition_variable, [&state](std::deque<SendTask> const& tasks) {
-                    return not state.is_running() or not tasks.empty();
-                });
-            }
+            // the parked flag is set under the queue lock (inside the wait predicate), so any
+            // producer that enqueues afterwards is guaranteed to observe it and signal us
+            state.send_tasks.wait(state.data_sent_condition_variable, [&state](std::deque<SendTask> const& tasks) {
+                state.send_thread_parked.store(true, std::memory_order_relaxed);
+                return not state.is_running() or not tasks.empty();
+            });
+            state.send_thread_parked.store(false, std::memory_order_relaxed);
         }
         state.clear_queues();
     }
 
     void ClientSocket::keep_receiving(State& state, OsSocketHandle const socket) {
         while (state.is_running()) {
+            if (state.has_on_data.load(std::memory_order_acquire)) {
+                if (not stream_incoming_data(state, socket)) {
+                    // connection is dead
+                    state.stop_running();
+                    break;
+                }
+                continue;
+            }
+
             auto processed_receive_task = false;
-            if (auto receive_task = try_dequeue_task(state.receive_tasks)) {
+            if (auto receive_task = detail::try_dequeue_task(state.receive_tasks)) {
                 processed_receive_task = true;
-                if (not process_receive_task(socket, *std::move(receive_task))) {
+                if (not process_receive_task(state, socket, *std::move(receive_task))) {
                     // connection is dead
                     state.stop_running();
                     break;
@@ -442,9 +1267,12 @@ namespace c2k {
                 state.receive_tasks.wait(
                         state.data_received_condition_variable,
                         [&state](std::deque<ReceiveTask> const& tasks) {
-                            return not state.is_running() or not tasks.empty();
+                            state.receive_thread_parked.store(true, std::memory_order_relaxed);
+                            return not state.is_running() or not tasks.empty()
+                                   or state.has_on_data.load(std::memory_order_acquire);
                         }
                 );
+                state.receive_thread_parked.store(false, std::memory_order_relaxed);
             }
         }
         state.clear_queues();
@@ -461,6 +1289,10 @@ namespace c2k {
         if (data.empty()) {
             throw SendError{ "cannot send 0 bytes of data" };
         }
+        auto const num_bytes = data.size();
+        if (not m_shared_state->make_room_in_send_queue(num_bytes)) {
+            throw SendError{ "send queue limit exceeded" };
+        }
         auto promise = std::promise<std::size_t>{};
         auto future = promise.get_future();
         auto const return_immediately = m_shared_state->send_tasks.apply([&](std::deque<SendTask>& send_tasks) {
@@ -470,6 +1302,7 @@ namespace c2k {
                 return true;
             }
             send_tasks.emplace_back(std::move(promise), std::move(data));
+            m_shared_state->grow_send_queue(num_bytes);
             return false;
         });
 
@@ -479,10 +1312,169 @@ namespace c2k {
             return future;
         }
 
-        m_shared_state->data_sent_condition_variable.notify_one();
+        notify_send_task_enqueued();
         return future;
     }
 
+    // clang-format off
+    [[nodiscard("the return value signals transmission completion; the data must stay alive until then")]]
+    std::future<std::size_t> ClientSocket::send(std::span<std::byte const> const data) {
+        // clang-format on
+        if (data.empty()) {
+            throw SendError{ "cannot send 0 bytes of data" };
+        }
+        if (not m_shared_state->make_room_in_send_queue(data.size())) {
+            throw SendError{ "send queue limit exceeded" };
+        }
+        auto promise = std::promise<std::size_t>{};
+        auto future = promise.get_future();
+        auto const return_immediately = m_shared_state->send_tasks.apply([&](std::deque<SendTask>& send_tasks) {
+            if (not m_shared_state->is_running()) {
+                promise.set_value({});
+                m_shared_state->data_sent_condition_variable.notify_one();
+                return true;
+            }
+            send_tasks.emplace_back(std::move(promise), data);
+            m_shared_state->grow_send_queue(data.size());
+            return false;
+        });
+
+        if (return_immediately) {
+            return future;
+        }
+
+        notify_send_task_enqueued();
+        return future;
+    }
+
+    [[nodiscard]] std::future<std::size_t> ClientSocket::send_file(std::filesystem::path const& path) {
+        auto file = SendTask::FileHandle{ std::fopen(path.string().c_str(), "rb") };
+        if (file == nullptr) {
+            throw SendError{ "failed to open file for sending: " + path.string() };
+        }
+        auto error_code = std::error_code{};
+        auto const file_length = std::filesystem::file_size(path, error_code);
+        if (error_code or file_length == 0) {
+            throw SendError{ "cannot send empty file: " + path.string() };
+        }
+        auto promise = std::promise<std::size_t>{};
+        auto future = promise.get_future();
+        auto const return_immediately = m_shared_state->send_tasks.apply([&](std::deque<SendTask>& send_tasks) {
+            if (not m_shared_state->is_running()) {
+                promise.set_value({});
+                m_shared_state->data_sent_condition_variable.notify_one();
+                return true;
+            }
+            send_tasks.emplace_back(std::move(promise), std::move(file), static_cast<std::size_t>(file_length));
+            return false;
+        });
+
+        if (return_immediately) {
+            return future;
+        }
+
+        notify_send_task_enqueued();
+        return future;
+    }
+
+    [[nodiscard]] ClientSocket::SendAwaitable ClientSocket::async_send(std::vector<std::byte> data) {
+        if (data.empty()) {
+            throw SendError{ "cannot send 0 bytes of data" };
+        }
+        return SendAwaitable{ *this, std::move(data) };
+    }
+
+    [[nodiscard]] ClientSocket::SendAwaitable ClientSocket::async_send(std::span<std::byte const> const data) {
+        if (data.empty()) {
+            throw SendError{ "cannot send 0 bytes of data" };
+        }
+        return SendAwaitable{ *this, data };
+    }
+
+    [[nodiscard]] ClientSocket::ReceiveAwaitable ClientSocket::async_receive(std::size_t const max_num_bytes) {
+        return async_receive(max_num_bytes, default_timeout);
+    }
+
+    // clang-format off
+    [[nodiscard]] ClientSocket::ReceiveAwaitable ClientSocket::async_receive(
+        std::size_t const max_num_bytes,
+        Timeout const timeout
+    ) { // clang-format on
+        if (max_num_bytes == 0) {
+            throw ReadError{ "trying to receive 0 bytes makes no sense" };
+        }
+        return ReceiveAwaitable{ *this, max_num_bytes, ReceiveTask::Kind::MaxBytes, timeout };
+    }
+
+    [[nodiscard]] ClientSocket::ReceiveAwaitable ClientSocket::async_receive_exact(std::size_t const num_bytes) {
+        return async_receive_exact(num_bytes, default_timeout);
+    }
+
+    // clang-format off
+    [[nodiscard]] ClientSocket::ReceiveAwaitable ClientSocket::async_receive_exact(
+        std::size_t const num_bytes,
+        Timeout const timeout
+    ) { // clang-format on
+        if (num_bytes == 0) {
+            throw ReadError{ "trying to receive 0 bytes makes no sense" };
+        }
+        return ReceiveAwaitable{ *this, num_bytes, ReceiveTask::Kind::Exact, timeout };
+    }
+
+    [[nodiscard]] bool ClientSocket::SendAwaitable::await_suspend(std::coroutine_handle<> const handle) {
+        auto& shared_state = *m_socket->m_shared_state;
+        auto const num_bytes = m_storage.empty() ? m_data.size() : m_storage.size();
+        if (not shared_state.make_room_in_send_queue(num_bytes)) {
+            throw SendError{ "send queue limit exceeded" };
+        }
+        auto const enqueued = shared_state.send_tasks.apply([&](std::deque<SendTask>& send_tasks) {
+            if (not shared_state.is_running()) {
+                return false;
+            }
+            if (m_storage.empty()) {
+                send_tasks.emplace_back(detail::TaskCompletion<std::size_t>{ m_state }, m_data);
+            } else {
+                send_tasks.emplace_back(detail::TaskCompletion<std::size_t>{ m_state }, std::move(m_storage));
+            }
+            shared_state.grow_send_queue(num_bytes);
+            return true;
+        });
+        if (enqueued) {
+            m_socket->notify_send_task_enqueued();
+        } else {
+            // the socket is already closed => complete immediately like clear_queues() would
+            m_state.set_value(0);
+        }
+        // once the task is enqueued it may complete on the socket thread at any moment; the
+        // atomic continuation slot decides whether that thread resumes the coroutine or whether
+        // we report the completed operation by not suspending at all
+        return m_state.try_set_continuation(handle);
+    }
+
+    [[nodiscard]] bool ClientSocket::ReceiveAwaitable::await_suspend(std::coroutine_handle<> const handle) {
+        auto& shared_state = *m_socket->m_shared_state;
+        auto const enqueued = shared_state.receive_tasks.apply([&](std::deque<ReceiveTask>& receive_tasks) {
+            if (not shared_state.is_running()) {
+                return false;
+            }
+            receive_tasks.emplace_back(
+                    detail::TaskCompletion<std::vector<std::byte>>{ m_state },
+                    m_max_num_bytes,
+                    m_kind,
+                    std::chrono::steady_clock::now() + m_timeout
+            );
+            return true;
+        });
+        if (enqueued) {
+            m_socket->notify_receive_task_enqueued();
+        } else {
+            // the socket is already closed => complete immediately like clear_queues() would
+            m_state.set_value({});
+        }
+        // see SendAwaitable::await_suspend for the rationale behind this protocol
+        return m_state.try_set_continuation(handle);
+    }
+
     [[nodiscard]] std::future<std::vector<std::byte>> ClientSocket::receive(std::size_t const max_num_bytes) {
         return receive_implementation(max_num_bytes, ReceiveTask::Kind::MaxBytes, std::nullopt);
     }
@@ -511,12 +1503,82 @@ namespace c2k {
         return receive_implementation(num_bytes, ReceiveTask::Kind::Exact, std::chrono::steady_clock::now() + timeout);
     }
 
+    [[nodiscard]] std::future<std::size_t> ClientSocket::send_framed(MessageBuffer message) {
+        auto payload = std::move(message).data();
+        if (payload.empty()) {
+            throw SendError{ "empty frames are not supported" };
+        }
+        if (not std::in_range<std::uint32_t>(payload.size())) {
+            throw SendError{ "frame payload exceeds the maximum encodable length" };
+        }
+        auto framed = MessageBuffer{};
+        framed << static_cast<std::uint32_t>(payload.size()) << payload;
+        return send(std::move(framed));
+    }
+
+    [[nodiscard]] std::future<std::vector<std::byte>> ClientSocket::receive_frame() {
+        return receive_implementation(detail::frame_chunk_length, ReceiveTask::Kind::Frame, std::nullopt);
+    }
+
+    [[nodiscard]] std::future<std::vector<std::byte>> ClientSocket::receive_frame(Timeout const timeout) {
+        return receive_implementation(
+                detail::frame_chunk_length,
+                ReceiveTask::Kind::Frame,
+                std::chrono::steady_clock::now() + timeout
+        );
+    }
+
+    [[nodiscard]] ClientSocket::Statistics ClientSocket::stats() const {
+        // the individual counters are loaded with relaxed ordering, so the snapshot is not
+        // guaranteed to represent a single consistent point in time, but every counter value
+        // is exact for the moment it was read
+        return Statistics{
+            .num_bytes_sent = m_shared_state->num_bytes_sent.load(std::memory_order_relaxed),
+            .num_bytes_received = m_shared_state->num_bytes_received.load(std::memory_order_relaxed),
+            .num_send_syscalls = m_shared_state->num_send_syscalls.load(std::memory_order_relaxed),
+            .num_receive_syscalls = m_shared_state->num_receive_syscalls.load(std::memory_order_relaxed),
+            .num_pending_send_tasks =
+                    m_shared_state->send_tasks.apply([](std::deque<SendTask> const& tasks) { return tasks.size(); }),
+            .num_pending_receive_tasks = m_shared_state->receive_tasks.apply(
+                    [](std::deque<ReceiveTask> const& tasks) { return tasks.size(); }
+            ),
+        };
+    }
+
     void ClientSocket::close() {
-        if (m_shared_state != nullptr) {
+        if (m_shared_state == nullptr) {
             // if this object was moved from, the cleanup will be done by the object
             // this object was moved into
-            m_shared_state->stop_running();
-            m_shared_state->clear_queues();
+            return;
+        }
+        if (m_event_loop != nullptr) {
+            // blocks until the event loop no longer accesses the socket, so that the
+            // OS handle may be closed safely afterwards; this is a single wakeup and
+            // handshake, no threads have to be joined in reactor mode
+            m_event_loop->remove_client(m_socket_descriptor.value());
+            m_event_loop = nullptr;
+        }
+        m_shared_state->stop_running();
+        m_shared_state->clear_queues();
+        if (m_send_thread.joinable() or m_receive_thread.joinable()) {
+            // joining the send and receive threads (and closing the OS handle afterwards) is
+            // handed to the background reaper, so that dropping many connections at once does
+            // not serialize their joins on the caller's thread; the shared state is co-owned
+            // by the task and stays alive until both threads have exited
+            socket_reaper().enqueue(
+                    [state = m_shared_state,
+                     send_thread = std::move(m_send_thread),
+                     receive_thread = std::move(m_receive_thread),
+                     descriptor = std::move(m_socket_descriptor)]() mutable {
+                        // both threads still use the socket and the shared state, so they must
+                        // have exited before either is released
+                        send_thread = std::jthread{};
+                        receive_thread = std::jthread{};
+                        state.reset();
+                        // closing the OS handle is the very last step
+                        auto const handle_owner = std::move(descriptor);
+                    }
+            );
         }
     }
 
@@ -550,20 +1612,106 @@ namespace c2k {
             return future;
         }
         // todo: can this also be simplified?
-        m_shared_state->data_received_condition_variable.notify_one();
+        notify_receive_task_enqueued();
         return future;
     }
 
-    [[nodiscard]] bool ClientSocket::process_receive_task(OsSocketHandle const socket, ReceiveTask task) {
+    void ClientSocket::set_on_data(std::function<void(std::span<std::byte const>)> callback) {
+        auto const active = static_cast<bool>(callback);
+        m_shared_state->on_data.apply([&callback](std::function<void(std::span<std::byte const>)>& stored) {
+            stored = std::move(callback);
+        });
+        m_shared_state->has_on_data.store(active, std::memory_order_release);
+        // locking the task queue before notifying prevents a lost wakeup (see State::stop_running())
+        m_shared_state->receive_tasks.apply([](std::deque<ReceiveTask> const&) {});
+        notify_receive_task_enqueued();
+        if (m_shared_state->wakeup != nullptr) {
+            // also interrupt a receive thread that is blocked waiting for incoming data
+            m_shared_state->wakeup->notify();
+        }
+    }
+
+    void ClientSocket::set_on_writable(std::function<void()> callback) {
+        auto const active = static_cast<bool>(callback);
+        m_shared_state->on_writable.apply([&callback](std::function<void()>& stored) { stored = std::move(callback); });
+        m_shared_state->has_on_writable.store(active, std::memory_order_release);
+    }
+
+    void ClientSocket::notify_send_task_enqueued() {
+        if (m_event_loop != nullptr) {
+            m_event_loop->wake();
+        } else if (m_shared_state->send_thread_parked.load(std::memory_order_relaxed)) {
+            m_shared_state->data_sent_condition_variable.notify_one();
+        }
+    }
+
+    void ClientSocket::notify_receive_task_enqueued() {
+        if (m_event_loop != nullptr) {
+            m_event_loop->wake();
+        } else if (m_shared_state->receive_thread_parked.load(std::memory_order_relaxed)) {
+            m_shared_state->data_received_condition_variable.notify_one();
+        }
+    }
+
+    enum class ReceiveWaitResult {
+        Readable,
+        Woken,
+        TimedOut,
+    };
+
+    // clang-format off
+    [[nodiscard]] static ReceiveWaitResult wait_for_data_or_wakeup(
+        AbstractSocket::OsSocketHandle const socket,
+        detail::Wakeup& wakeup,
+        std::chrono::steady_clock::time_point const deadline
+    ) { // clang-format on
+        detail::PollFileDescriptor file_descriptors[] = {
+            { .fd = static_cast<decltype(detail::PollFileDescriptor{}.fd)>(socket), .events = POLLIN, .revents = 0 },
+            { .fd = static_cast<decltype(detail::PollFileDescriptor{}.fd)>(wakeup.read_handle()),
+             .events = POLLIN,
+             .revents = 0 },
+        };
+        auto const remaining = std::chrono::ceil<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now());
+        auto const timeout_milliseconds = static_cast<int>(
+                std::clamp<std::int64_t>(remaining.count(), 0, std::numeric_limits<int>::max())
+        );
+        auto const poll_result = detail::poll_file_descriptors(
+                file_descriptors,
+                std::size(file_descriptors),
+                timeout_milliseconds
+        );
+        if (poll_result == constants::socket_error) {
+            throw std::runtime_error{ "failed to poll on socket" };
+        }
+        if (poll_result == 0) {
+            return ReceiveWaitResult::TimedOut;
+        }
+        if ((file_descriptors[1].revents & POLLIN) != 0) {
+            wakeup.clear();
+            if ((file_descriptors[0].revents & POLLIN) == 0) {
+                return ReceiveWaitResult::Woken;
+            }
+        }
+        return ReceiveWaitResult::Readable;
+    }
+
+    [[nodiscard]] bool ClientSocket::process_receive_task(State& state, OsSocketHandle const socket, ReceiveTask task) {
+        if (task.kind == ReceiveTask::Kind::Frame) {
+            return process_receive_frame_task(state, socket, std::move(task));
+        }
         if (not std::in_range<constants::SendReceiveSize>(task.max_num_bytes)) {
             throw std::runtime_error{ "size of message to be received exceeds allowed maximum" };
         }
+        assert(state.wakeup != nullptr and "threaded receive path requires the wakeup handle");
 
+        // the result buffer is allocated once up front and the data is received directly into
+        // its tail, so the steady-state receive path performs no further allocations or copies
         auto receive_buffer = std::vector<std::byte>{};
-        receive_buffer.reserve(task.max_num_bytes);
+        receive_buffer.resize(task.max_num_bytes);
+        auto num_bytes_received = std::size_t{ 0 };
 
         while (true) {
-            assert(receive_buffer.size() < task.max_num_bytes);
+            assert(num_bytes_received < task.max_num_bytes);
 
             auto const timeout_exceeded = std::chrono::steady_clock::now() >= task.end_time;
             if (timeout_exceeded) {
@@ -572,25 +1720,35 @@ namespace c2k {
                     return true;
                 }
 
+                receive_buffer.resize(num_bytes_received);
                 task.promise.set_value(std::move(receive_buffer));
                 return true;
             }
 
-            if (not is_socket_ready(socket, SelectStatusCategory::Read, 10)) {
+            // instead of periodically polling the socket, we block until data arrives, the task
+            // deadline expires, or another thread interrupts us via the wakeup handle
+            auto const wait_result = wait_for_data_or_wakeup(socket, *state.wakeup, task.end_time);
+            if (wait_result == ReceiveWaitResult::TimedOut) {
+                continue; // the deadline check at the top of the loop fulfills the promise
+            }
+            if (wait_result == ReceiveWaitResult::Woken) {
+                if (not state.is_running()) {
+                    // the socket is being closed => fulfill the promise like clear_queues() would
+                    task.promise.set_value({});
+                    return true;
+                }
                 continue;
             }
 
-            auto current_chunk = std::vector<std::byte>{};
-            current_chunk.resize(task.max_num_bytes);
-
             // clang-format off
             auto const receive_result = recv(
                 socket,
-                reinterpret_cast<char*>(current_chunk.data()),
-                static_cast<constants::SendReceiveSize>(task.max_num_bytes - receive_buffer.size()),
+                reinterpret_cast<char*>(receive_buffer.data()) + num_bytes_received,
+                static_cast<constants::SendReceiveSize>(task.max_num_bytes - num_bytes_received),
                 0
             );
             // clang-format on
+            state.num_receive_syscalls.fetch_add(1, std::memory_order_relaxed);
 
             if (receive_result == 0 or receive_result == constants::socket_error) {
                 // connection has been gracefully closed or connection no longer active => close socket
@@ -599,46 +1757,405 @@ namespace c2k {
                     return false;
                 }
 
+                receive_buffer.resize(num_bytes_received);
                 task.promise.set_value(std::move(receive_buffer));
                 return false;
             }
 
-            current_chunk.resize(static_cast<std::size_t>(receive_result));
-            std::copy(current_chunk.cbegin(), current_chunk.cend(), std::back_inserter(receive_buffer));
+            num_bytes_received += static_cast<std::size_t>(receive_result);
+            state.num_bytes_received.fetch_add(static_cast<std::uint64_t>(receive_result), std::memory_order_relaxed);
 
-            if (task.kind == ReceiveTask::Kind::MaxBytes or receive_buffer.size() >= task.max_num_bytes) {
-                assert(receive_buffer.size() <= task.max_num_bytes);
+            if (task.kind == ReceiveTask::Kind::MaxBytes or num_bytes_received >= task.max_num_bytes) {
+                assert(num_bytes_received <= task.max_num_bytes);
+                receive_buffer.resize(num_bytes_received);
                 task.promise.set_value(std::move(receive_buffer));
                 return true;
             }
         }
     }
 
-    [[nodiscard]] bool ClientSocket::process_send_task(OsSocketHandle const socket, SendTask task) {
-        if (not std::in_range<constants::SendReceiveSize>(task.data.size())) {
-            throw std::runtime_error{ "size of message to be sent exceeds allowed maximum" };
+    // clang-format off
+    [[nodiscard]] bool ClientSocket::process_receive_frame_task(
+        State& state,
+        OsSocketHandle const socket,
+        ReceiveTask task
+    ) { // clang-format on
+        assert(state.wakeup != nullptr and "threaded receive path requires the wakeup handle");
+
+        while (true) {
+            // frames that are already buffered complete without touching the socket
+            if (auto frame = detail::try_extract_frame(state.framing_buffer)) {
+                task.promise.set_value(*std::move(frame));
+                return true;
+            }
+
+            if (std::chrono::steady_clock::now() >= task.end_time) {
+                task.promise.set_exception(std::make_exception_ptr(TimeoutError{}));
+                return true;
+            }
+
+            // instead of periodically polling the socket, we block until data arrives, the task
+            // deadline expires, or another thread interrupts us via the wakeup handle
+            auto const wait_result = wait_for_data_or_wakeup(socket, *state.wakeup, task.end_time);
+            if (wait_result == ReceiveWaitResult::TimedOut) {
+                continue; // the deadline check at the top of the loop fulfills the promise
+            }
+            if (wait_result == ReceiveWaitResult::Woken) {
+                if (not state.is_running()) {
+                    // the socket is being closed => fulfill the promise like clear_queues() would
+                    task.promise.set_value({});
+                    return true;
+                }
+                continue;
+            }
+
+            // the incoming bytes are received directly into the tail of the framing buffer
+            auto const old_length = state.framing_buffer.size();
+            state.framing_buffer.resize(old_length + detail::frame_chunk_length);
+            // clang-format off
+            auto const receive_result = recv(
+                socket,
+                reinterpret_cast<char*>(state.framing_buffer.data()) + old_length,
+                static_cast<constants::SendReceiveSize>(detail::frame_chunk_length),
+                0
+            );
+            // clang-format on
+            state.num_receive_syscalls.fetch_add(1, std::memory_order_relaxed);
+
+            if (receive_result == 0 or receive_result == constants::socket_error) {
+                // connection has been gracefully closed or connection no longer active => close socket
+                state.framing_buffer.resize(old_length);
+                task.promise.set_exception(std::make_exception_ptr(ReadError{}));
+                return false;
+            }
+
+            state.framing_buffer.resize(old_length + static_cast<std::size_t>(receive_result));
+            state.num_bytes_received.fetch_add(static_cast<std::uint64_t>(receive_result), std::memory_order_relaxed);
+        }
+    }
+
+    [[nodiscard]] bool ClientSocket::stream_incoming_data(State& state, OsSocketHandle const socket) {
+        assert(state.wakeup != nullptr and "threaded receive path requires the wakeup handle");
+        // the wakeup handle interrupts us when the subscription changes or the socket is closed
+        static constexpr auto no_deadline = std::chrono::steady_clock::time_point::max();
+
+        auto const wait_result = wait_for_data_or_wakeup(socket, *state.wakeup, no_deadline);
+        if (wait_result != ReceiveWaitResult::Readable) {
+            // the caller re-evaluates the running state and the subscription
+            return true;
         }
+
+        auto& buffer = state.streaming_buffer;
+        buffer.resize(detail::streaming_chunk_length);
+        // clang-format off
+        auto const receive_result = recv(
+            socket,
+            reinterpret_cast<char*>(buffer.data()),
+            static_cast<constants::SendReceiveSize>(buffer.size()),
+            0
+        );
+        // clang-format on
+        state.num_receive_syscalls.fetch_add(1, std::memory_order_relaxed);
+
+        if (receive_result == 0 or receive_result == constants::socket_error) {
+            // connection has been gracefully closed or connection no longer active => the
+            // subscriber is informed via a final invocation with an empty span
+            state.invoke_on_data({});
+            return false;
+        }
+
+        state.num_bytes_received.fetch_add(static_cast<std::uint64_t>(receive_result), std::memory_order_relaxed);
+        state.invoke_on_data(std::span{ buffer.data(), static_cast<std::size_t>(receive_result) });
+        return true;
+    }
+
+#ifdef _WIN32
+    using GatherBuffer = WSABUF;
+
+    [[nodiscard]] static GatherBuffer make_gather_buffer(std::byte const* const data, std::size_t const length) {
+        return GatherBuffer{ .len = static_cast<ULONG>(length),
+                             .buf = reinterpret_cast<CHAR*>(const_cast<std::byte*>(data)) };
+    }
+
+    // clang-format off
+    [[nodiscard]] static std::optional<std::size_t> send_gathered(
+        AbstractSocket::OsSocketHandle const socket,
+        GatherBuffer* const buffers,
+        std::size_t const num_buffers
+    ) { // clang-format on
+        auto num_bytes_sent = DWORD{ 0 };
+        if (WSASend(socket, buffers, static_cast<DWORD>(num_buffers), &num_bytes_sent, 0, nullptr, nullptr) != 0) {
+            return std::nullopt;
+        }
+        return static_cast<std::size_t>(num_bytes_sent);
+    }
+#else
+    using GatherBuffer = iovec;
+
+    [[nodiscard]] static GatherBuffer make_gather_buffer(std::byte const* const data, std::size_t const length) {
+        return GatherBuffer{ .iov_base = const_cast<std::byte*>(data), .iov_len = length };
+    }
+
+    // clang-format off
+    [[nodiscard]] static std::optional<std::size_t> send_gathered(
+        AbstractSocket::OsSocketHandle const socket,
+        GatherBuffer* const buffers,
+        std::size_t const num_buffers
+    ) { // clang-format on
+        auto message = msghdr{};
+        message.msg_iov = buffers;
+        message.msg_iovlen = static_cast<decltype(message.msg_iovlen)>(num_buffers);
+        auto const result = sendmsg(socket, &message, constants::send_flags);
+        if (result == constants::socket_error) {
+            return std::nullopt;
+        }
+        return static_cast<std::size_t>(result);
+    }
+#endif
+
+    [[nodiscard]] bool ClientSocket::refill_file_chunk(SendTask& task) {
+        task.storage.resize(detail::file_send_chunk_length);
+        auto const num_bytes_read = std::fread(task.storage.data(), 1, task.storage.size(), task.file.get());
+        task.storage.resize(num_bytes_read);
+        task.data = task.storage;
+        return num_bytes_read > 0;
+    }
+
+    [[nodiscard]] bool ClientSocket::process_file_send_task(State& state, OsSocketHandle const socket, SendTask& task) {
+#ifdef __linux__
+        // the kernel moves the file contents directly into the socket, so the payload never
+        // enters userspace
+        auto offset = off_t{ 0 };
+        auto num_bytes_remaining = task.file_length;
+        while (num_bytes_remaining > 0) {
+            auto const chunk_length = std::min(num_bytes_remaining, detail::file_send_chunk_length);
+            auto const result = ::sendfile(socket, fileno(task.file.get()), &offset, chunk_length);
+            state.num_send_syscalls.fetch_add(1, std::memory_order_relaxed);
+            if (result <= 0) {
+                // connection no longer active
+                task.promise.set_value(task.file_length - num_bytes_remaining);
+                return false;
+            }
+            num_bytes_remaining -= static_cast<std::size_t>(result);
+            state.num_bytes_sent.fetch_add(static_cast<std::uint64_t>(result), std::memory_order_relaxed);
+        }
+#else
+        // no kernel support => stream the file through a bounded userspace buffer
+        auto num_bytes_sent_total = std::size_t{ 0 };
+        while (refill_file_chunk(task)) {
+            auto num_bytes_sent = std::size_t{ 0 };
+            while (num_bytes_sent < task.data.size()) {
+                // clang-format off
+                auto const result = ::send(
+                    socket,
+                    reinterpret_cast<char const*>(task.data.data()) + num_bytes_sent,
+                    static_cast<constants::SendReceiveSize>(task.data.size() - num_bytes_sent),
+                    constants::send_flags
+                );
+                // clang-format on
+                state.num_send_syscalls.fetch_add(1, std::memory_order_relaxed);
+                if (result == constants::socket_error) {
+                    // connection no longer active
+                    task.promise.set_value(num_bytes_sent_total + num_bytes_sent);
+                    return false;
+                }
+                num_bytes_sent += static_cast<std::size_t>(result);
+                state.num_bytes_sent.fetch_add(static_cast<std::uint64_t>(result), std::memory_order_relaxed);
+            }
+            num_bytes_sent_total += num_bytes_sent;
+        }
+#endif
+        task.promise.set_value(task.file_length);
+        return true;
+    }
+
+#ifdef __linux__
+    // payloads above this size are transmitted with MSG_ZEROCOPY when enabled; smaller sends
+    // are cheaper to copy than to pin
+    static constexpr auto zero_copy_threshold = std::size_t{ 1 } << 20;
+
+    // clang-format off
+    [[nodiscard]] bool ClientSocket::process_zero_copy_send_task(
+        State& state,
+        OsSocketHandle const socket,
+        SendTask& task
+    ) { // clang-format on
         auto num_bytes_sent = std::size_t{ 0 };
-        auto data_to_send = reinterpret_cast<char const*>(task.data.data());
         while (num_bytes_sent < task.data.size()) {
-            auto const num_bytes_remaining = task.data.size() - num_bytes_sent;
             // clang-format off
             auto const result = ::send(
                 socket,
-                data_to_send,
-                static_cast<constants::SendReceiveSize>(num_bytes_remaining),
+                reinterpret_cast<char const*>(task.data.data()) + num_bytes_sent,
+                static_cast<constants::SendReceiveSize>(task.data.size() - num_bytes_sent),
+                constants::send_flags | MSG_ZEROCOPY
+            );
+            // clang-format on
+            state.num_send_syscalls.fetch_add(1, std::memory_order_relaxed);
+            if (result == constants::socket_error) {
+                if (errno == ENOBUFS) {
+                    // the kernel ran out of lockable memory => fall back to the copied path
+                    // for the remainder of the payload
+                    break;
+                }
+                task.promise.set_value(num_bytes_sent);
+                return false;
+            }
+            ++state.num_zero_copy_sends_issued;
+            num_bytes_sent += static_cast<std::size_t>(result);
+            state.num_bytes_sent.fetch_add(static_cast<std::uint64_t>(result), std::memory_order_relaxed);
+        }
+
+        while (num_bytes_sent < task.data.size()) {
+            // clang-format off
+            auto const result = ::send(
+                socket,
+                reinterpret_cast<char const*>(task.data.data()) + num_bytes_sent,
+                static_cast<constants::SendReceiveSize>(task.data.size() - num_bytes_sent),
                 constants::send_flags
             );
             // clang-format on
+            state.num_send_syscalls.fetch_add(1, std::memory_order_relaxed);
             if (result == constants::socket_error) {
-                // connection no longer active
-                task.promise.set_value(0);
+                task.promise.set_value(num_bytes_sent);
                 return false;
             }
-            data_to_send += result;
             num_bytes_sent += static_cast<std::size_t>(result);
+            state.num_bytes_sent.fetch_add(static_cast<std::uint64_t>(result), std::memory_order_relaxed);
+        }
+
+        // we must wait until the kernel has dropped its references onto the payload pages,
+        // otherwise the buffer could be freed (and its memory reused) while the data is still
+        // being transmitted
+        while (state.num_zero_copy_sends_completed < state.num_zero_copy_sends_issued) {
+            if (not state.is_running()) {
+                task.promise.set_value(num_bytes_sent);
+                return false;
+            }
+            auto descriptor = detail::PollFileDescriptor{
+                .fd = static_cast<decltype(detail::PollFileDescriptor{}.fd)>(socket),
+                .events = 0, // completion notifications are signalled via POLLERR
+                .revents = 0,
+            };
+            if (detail::poll_file_descriptors(&descriptor, 1, 100) == constants::socket_error) {
+                task.promise.set_value(num_bytes_sent);
+                return false;
+            }
+
+            alignas(cmsghdr) char control[256];
+            auto message = msghdr{};
+            message.msg_control = control;
+            message.msg_controllen = sizeof(control);
+            if (recvmsg(socket, &message, MSG_ERRQUEUE) == -1) {
+                continue;
+            }
+            for (auto header = CMSG_FIRSTHDR(&message); header != nullptr; header = CMSG_NXTHDR(&message, header)) {
+                auto const is_error_record = (header->cmsg_level == SOL_IP and header->cmsg_type == IP_RECVERR)
+                                             or (header->cmsg_level == SOL_IPV6 and header->cmsg_type == IPV6_RECVERR);
+                if (not is_error_record) {
+                    continue;
+                }
+                auto const* const error = reinterpret_cast<sock_extended_err const*>(CMSG_DATA(header));
+                if (error->ee_origin == SO_EE_ORIGIN_ZEROCOPY) {
+                    // ee_data holds the highest sequence number of the completed range
+                    state.num_zero_copy_sends_completed =
+                            std::max(state.num_zero_copy_sends_completed, error->ee_data + 1);
+                }
+            }
+        }
+
+        task.promise.set_value(task.data.size());
+        return true;
+    }
+#endif
+
+    [[nodiscard]] bool ClientSocket::process_send_tasks(State& state, OsSocketHandle const socket, std::deque<SendTask> tasks) {
+        for (auto const& task : tasks) {
+            if (not std::in_range<constants::SendReceiveSize>(task.data.size())) {
+                throw std::runtime_error{ "size of message to be sent exceeds allowed maximum" };
+            }
+        }
+
+        // upper bound for the number of buffers handed to the kernel per gather call
+        static constexpr auto max_gather_length = std::size_t{ 64 };
+
+        // file-backed payloads (and large payloads eligible for zero-copy transmission) are
+        // processed outside of the gather batches
+        auto const is_processed_individually = [&](SendTask const& task) {
+            if (task.file != nullptr) {
+                return true;
+            }
+#ifdef __linux__
+            if (state.zero_copy_enabled and task.data.size() >= zero_copy_threshold) {
+                return true;
+            }
+#endif
+            return false;
+        };
+
+        auto current_task = std::size_t{ 0 };
+        auto num_bytes_sent_of_current_task = std::size_t{ 0 };
+        while (current_task < tasks.size()) {
+            if (num_bytes_sent_of_current_task == 0 and is_processed_individually(tasks[current_task])) {
+                auto& task = tasks[current_task];
+                auto succeeded = false;
+                if (task.file != nullptr) {
+                    succeeded = process_file_send_task(state, socket, task);
+                }
+#ifdef __linux__
+                else {
+                    succeeded = process_zero_copy_send_task(state, socket, task);
+                }
+#endif
+                if (not succeeded) {
+                    // connection no longer active; the failed task has already been fulfilled
+                    for (auto i = current_task + 1; i < tasks.size(); ++i) {
+                        tasks[i].promise.set_value(0);
+                    }
+                    return false;
+                }
+                ++current_task;
+                continue;
+            }
+
+            GatherBuffer buffers[max_gather_length];
+            auto num_buffers = std::size_t{ 0 };
+            for (auto i = current_task; i < tasks.size() and num_buffers < max_gather_length; ++i) {
+                if (i != current_task and is_processed_individually(tasks[i])) {
+                    break;
+                }
+                auto const offset = (i == current_task ? num_bytes_sent_of_current_task : 0);
+                buffers[num_buffers] = make_gather_buffer(tasks[i].data.data() + offset, tasks[i].data.size() - offset);
+                ++num_buffers;
+            }
+
+            auto const send_result = send_gathered(socket, buffers, num_buffers);
+            state.num_send_syscalls.fetch_add(1, std::memory_order_relaxed);
+            if (not send_result.has_value()) {
+                // connection no longer active
+                for (auto i = current_task; i < tasks.size(); ++i) {
+                    tasks[i].promise.set_value(0);
+                }
+                return false;
+            }
+
+            state.num_bytes_sent.fetch_add(*send_result, std::memory_order_relaxed);
+
+            // fulfill the promises of all tasks that have been fully transmitted by this call
+            auto num_bytes_to_account = *send_result;
+            while (num_bytes_to_account > 0) {
+                auto& task = tasks[current_task];
+                auto const num_bytes_remaining = task.data.size() - num_bytes_sent_of_current_task;
+                if (num_bytes_to_account >= num_bytes_remaining) {
+                    num_bytes_to_account -= num_bytes_remaining;
+                    task.promise.set_value(task.data.size());
+                    ++current_task;
+                    num_bytes_sent_of_current_task = 0;
+                } else {
+                    num_bytes_sent_of_current_task += num_bytes_to_account;
+                    num_bytes_to_account = 0;
+                }
+            }
         }
-        task.promise.set_value(num_bytes_sent);
         return true;
     }
 
@@ -2,18 +2,25 @@
 
 #include <cstdint>
 #include <cstdlib>
+#include <stdexcept>
 
 #ifdef _WIN32
 
 #include <winsock2.h>
 #include <ws2tcpip.h>
+// must come after winsock2.h
+#include <afunix.h>
 
 #else
 
+#include <fcntl.h>
 #include <netdb.h>
 #include <netinet/tcp.h>
+#include <poll.h>
 #include <sys/socket.h>
 #include <sys/types.h>
+#include <sys/uio.h>
+#include <sys/un.h>
 #include <unistd.h>
 
 #endif
@@ -45,6 +52,64 @@ namespace c2k::constants {
 
 } // namespace c2k::constants
 
+namespace c2k::detail {
+
+#ifdef _WIN32
+
+    using PollFileDescriptor = WSAPOLLFD;
+
+    inline void set_non_blocking(std::uintptr_t const socket) {
+        auto non_blocking = u_long{ 1 };
+        if (ioctlsocket(socket, FIONBIO, &non_blocking) != 0) {
+            throw std::runtime_error{ "failed to set socket into non-blocking mode" };
+        }
+    }
+
+    inline void set_blocking(std::uintptr_t const socket) {
+        auto non_blocking = u_long{ 0 };
+        if (ioctlsocket(socket, FIONBIO, &non_blocking) != 0) {
+            throw std::runtime_error{ "failed to set socket into blocking mode" };
+        }
+    }
+
+    inline int poll_file_descriptors(
+            PollFileDescriptor* const file_descriptors,
+            std::size_t const count,
+            int const timeout_milliseconds
+    ) {
+        return WSAPoll(file_descriptors, static_cast<ULONG>(count), timeout_milliseconds);
+    }
+
+#else
+
+    using PollFileDescriptor = pollfd;
+
+    inline void set_non_blocking(int const socket) {
+        auto const flags = fcntl(socket, F_GETFL, 0);
+        if (flags == -1 or fcntl(socket, F_SETFL, flags | O_NONBLOCK) == -1) {
+            throw std::runtime_error{ "failed to set socket into non-blocking mode" };
+        }
+    }
+
+    inline void set_blocking(int const socket) {
+        auto const flags = fcntl(socket, F_GETFL, 0);
+        if (flags == -1 or fcntl(socket, F_SETFL, flags & ~O_NONBLOCK) == -1) {
+            throw std::runtime_error{ "failed to set socket into blocking mode" };
+        }
+    }
+
+    inline int poll_file_descriptors(
+            PollFileDescriptor* const file_descriptors,
+            std::size_t const count,
+            int const timeout_milliseconds
+    ) {
+        return ::poll(file_descriptors, static_cast<nfds_t>(count), timeout_milliseconds);
+    }
+
+#endif
+
+} // namespace c2k::detail
+
 #ifndef _WIN32
 
 inline int closesocket(int const socket) {
@@ -29,6 +29,105 @@ namespace c2k {
         return ClientSocket{ address_family, host, port };
     }
 
+    // clang-format off
+    [[nodiscard]] ClientSocket Sockets::create_client(
+        AddressFamily const address_family,
+        std::string const& host,
+        std::uint16_t const port,
+        Reactor& reactor,
+        Sockets const&
+    ) { // clang-format on
+        return ClientSocket{ address_family, host, port, reactor };
+    }
+
+    // clang-format off
+    [[nodiscard]] ClientSocket Sockets::create_client(
+        AddressFamily const address_family,
+        std::string const& host,
+        std::uint16_t const port,
+        SocketOptions const& options,
+        Sockets const&
+    ) { // clang-format on
+        return ClientSocket{ address_family, host, port, options };
+    }
+
+    // clang-format off
+    [[nodiscard]] ClientSocket Sockets::create_client(
+        AddressFamily const address_family,
+        std::string const& host,
+        std::uint16_t const port,
+        SocketOptions const& options,
+        Reactor& reactor,
+        Sockets const&
+    ) { // clang-format on
+        return ClientSocket{ address_family, host, port, options, reactor };
+    }
+
+    // clang-format off
+    [[nodiscard]] ClientSocket Sockets::create_client(
+        std::filesystem::path const& path,
+        Sockets const&
+    ) { // clang-format on
+        return ClientSocket{ path };
+    }
+
+    // clang-format off
+    [[nodiscard]] ClientSocket Sockets::create_client(
+        std::filesystem::path const& path,
+        Reactor& reactor,
+        Sockets const&
+    ) { // clang-format on
+        return ClientSocket{ path, reactor };
+    }
+
+    // clang-format off
+    [[nodiscard]] ClientSocket Sockets::create_client(
+        std::filesystem::path const& path,
+        SocketOptions const& options,
+        Sockets const&
+    ) { // clang-format on
+        return ClientSocket{ path, options };
+    }
+
+    // clang-format off
+    [[nodiscard]] ClientSocket Sockets::create_client(
+        std::filesystem::path const& path,
+        SocketOptions const& options,
+        Reactor& reactor,
+        Sockets const&
+    ) { // clang-format on
+        return ClientSocket{ path, options, reactor };
+    }
+
+    // clang-format off
+    [[nodiscard]] std::future<ClientSocket> Sockets::create_client_async(
+        AddressFamily const address_family,
+        std::string const& host,
+        std::uint16_t const port,
+        ClientSocket::Timeout const timeout,
+        Sockets const&
+    ) { // clang-format on
+        // the host is copied into the task since the caller's string may die before the
+        // background thread resolves it
+        return std::async(std::launch::async, [address_family, host, port, timeout] {
+            return ClientSocket{ address_family, host, port, timeout };
+        });
+    }
+
+    // clang-format off
+    [[nodiscard]] std::future<ClientSocket> Sockets::create_client_async(
+        AddressFamily const address_family,
+        std::string const& host,
+        std::uint16_t const port,
+        ClientSocket::Timeout const timeout,
+        Reactor& reactor,
+        Sockets const&
+    ) { // clang-format on
+        return std::async(std::launch::async, [address_family, host, port, timeout, &reactor] {
+            return ClientSocket{ address_family, host, port, timeout, reactor };
+        });
+    }
+
     [[nodiscard]] Sockets const& Sockets::instance() {
         static auto handle = Sockets{};
         return handle;
@@ -0,0 +1,140 @@
+#include "socket_headers.hpp"
+#include "sockets/detail/udp_socket.hpp"
+#include <algorithm>
+#include <array>
+#include <tuple>
+#include <vector>
+
+namespace c2k {
+    // the batch size per syscall is capped to keep the stack-allocated bookkeeping small
+    static constexpr auto max_batch_size = std::size_t{ 64 };
+
+    UdpSocket::UdpSocket(AddressFamily const address_family, std::uint16_t const port)
+        : AbstractSocket{ detail::initialize_udp_socket(address_family, port, nullptr) } {}
+
+    UdpSocket::UdpSocket(AddressFamily const address_family, std::string const& host, std::uint16_t const port)
+        : AbstractSocket{ detail::initialize_udp_socket(address_family, port, host.c_str()) } {}
+
+    std::size_t UdpSocket::send(std::span<std::byte const> const datagram) {
+        if (datagram.empty()) {
+            throw SendError{ "cannot send 0 bytes of data" };
+        }
+        // clang-format off
+        auto const result = ::send(
+            m_socket_descriptor.value(),
+            reinterpret_cast<char const*>(datagram.data()),
+            static_cast<constants::SendReceiveSize>(datagram.size()),
+            constants::send_flags
+        );
+        // clang-format on
+        if (result == constants::socket_error) {
+            throw SendError{ "failed to send datagram" };
+        }
+        return static_cast<std::size_t>(result);
+    }
+
+    std::size_t UdpSocket::send(std::span<std::vector<std::byte> const> const datagrams) {
+        auto num_datagrams_sent = std::size_t{ 0 };
+#ifdef __linux__
+        while (num_datagrams_sent < datagrams.size()) {
+            auto const batch = datagrams.subspan(
+                    num_datagrams_sent,
+                    std::min(max_batch_size, datagrams.size() - num_datagrams_sent)
+            );
+            auto buffers = std::array<iovec, max_batch_size>{};
+            auto message_headers = std::array<mmsghdr, max_batch_size>{};
+            for (auto i = std::size_t{ 0 }; i < batch.size(); ++i) {
+                buffers[i].iov_base = const_cast<std::byte*>(batch[i].data());
+                buffers[i].iov_len = batch[i].size();
+                message_headers[i].msg_hdr.msg_iov = &buffers[i];
+                message_headers[i].msg_hdr.msg_iovlen = 1;
+            }
+            auto const result = sendmmsg(
+                    m_socket_descriptor.value(),
+                    message_headers.data(),
+                    static_cast<unsigned int>(batch.size()),
+                    constants::send_flags
+            );
+            if (result == constants::socket_error) {
+                throw SendError{ "failed to send datagrams" };
+            }
+            num_datagrams_sent += static_cast<std::size_t>(result);
+            if (static_cast<std::size_t>(result) < batch.size()) {
+                // the kernel could not queue the whole batch
+                break;
+            }
+        }
+#else
+        for (auto const& datagram : datagrams) {
+            std::ignore = send(std::span{ datagram });
+            ++num_datagrams_sent;
+        }
+#endif
+        return num_datagrams_sent;
+    }
+
+    // clang-format off
+    [[nodiscard]] std::vector<std::vector<std::byte>> UdpSocket::receive(
+        std::size_t const max_num_datagrams,
+        std::size_t const max_datagram_size
+    ) { // clang-format on
+        if (max_num_datagrams == 0 or max_datagram_size == 0) {
+            throw ReadError{ "trying to receive 0 bytes makes no sense" };
+        }
+        auto const batch_size = std::min(max_batch_size, max_num_datagrams);
+        // one contiguous allocation backs all receive buffers of the batch
+        auto storage = std::vector<std::byte>(batch_size * max_datagram_size);
+        auto datagrams = std::vector<std::vector<std::byte>>{};
+#ifdef __linux__
+        auto buffers = std::array<iovec, max_batch_size>{};
+        auto message_headers = std::array<mmsghdr, max_batch_size>{};
+        for (auto i = std::size_t{ 0 }; i < batch_size; ++i) {
+            buffers[i].iov_base = storage.data() + i * max_datagram_size;
+            buffers[i].iov_len = max_datagram_size;
+            message_headers[i].msg_hdr.msg_iov = &buffers[i];
+            message_headers[i].msg_hdr.msg_iovlen = 1;
+        }
+        // MSG_WAITFORONE blocks until the first datagram and then only takes what is already there
+        auto const result = recvmmsg(
+                m_socket_descriptor.value(),
+                message_headers.data(),
+                static_cast<unsigned int>(batch_size),
+                MSG_WAITFORONE,
+                nullptr
+        );
+        if (result == constants::socket_error) {
+            throw ReadError{ "failed to receive datagrams" };
+        }
+        datagrams.reserve(static_cast<std::size_t>(result));
+        for (auto i = std::size_t{ 0 }; i < static_cast<std::size_t>(result); ++i) {
+            auto const begin = storage.data() + i * max_datagram_size;
+            datagrams.emplace_back(begin, begin + message_headers[i].msg_len);
+        }
+#else
+        for (auto i = std::size_t{ 0 }; i < batch_size; ++i) {
+            if (i > 0) {
+                // only the first datagram may block; afterwards we just drain what is there
+                auto ready_descriptor = detail::PollFileDescriptor{};
+                ready_descriptor.fd = m_socket_descriptor.value();
+                ready_descriptor.events = POLLIN;
+                if (detail::poll_file_descriptors(&ready_descriptor, 1, 0) <= 0) {
+                    break;
+                }
+            }
+            // clang-format off
+            auto const result = recv(
+                m_socket_descriptor.value(),
+                reinterpret_cast<char*>(storage.data()),
+                static_cast<constants::SendReceiveSize>(max_datagram_size),
+                0
+            );
+            // clang-format on
+            if (result == constants::socket_error) {
+                throw ReadError{ "failed to receive datagrams" };
+            }
+            datagrams.emplace_back(storage.data(), storage.data() + result);
+        }
+#endif
+        return datagrams;
+    }
+} // namespace c2k
@@ -1,7 +1,13 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
 #include <future>
 #include <gtest/gtest.h>
 #include <numeric>
 #include <sockets/sockets.hpp>
+#include <utility>
 
 static constexpr auto localhost = "127.0.0.1";
 
@@ -265,6 +271,7 @@ TEST(SocketsTests, ClientInitialization) {
 
     auto const client = c2k::Sockets::create_client(c2k::AddressFamily::Ipv4, localhost, port);
     EXPECT_EQ(client.remote_address().port, port);
+    EXPECT_EQ(client.remote_address().address(), localhost);
 }
 
 TEST(SocketsTests, SendAndReceiveMultipleTimes) {
@@ -397,4 +404,540 @@ TEST(SocketsTests, ReceiveIntegralValuesExceedingCustomTimeoutThrowsException) {
     };
 
     EXPECT_THROW({ code_that_should_throw(); }, c2k::TimeoutError);
-}
\ No newline at end of file
+}
+TEST(SocketsTests, SendAndReceiveViaReactor) {
+    auto reactor = c2k::Reactor{ 2 };
+
+    auto promise = std::promise<int>{};
+    auto future = promise.get_future();
+    auto const server = c2k::Sockets::create_server(
+            c2k::AddressFamily::Ipv4,
+            0,
+            [&promise](c2k::ClientSocket client) {
+                auto buffer = c2k::MessageBuffer{};
+                buffer << client.receive_exact(sizeof(int)).get();
+                promise.set_value(buffer.try_extract<int>().value());
+            },
+            reactor
+    );
+
+    auto const port = server.local_address().port;
+
+    static constexpr auto value = 42;
+    auto client = c2k::Sockets::create_client(c2k::AddressFamily::Ipv4, localhost, port, reactor);
+    auto const num_bytes_sent = client.send(value).get();
+    EXPECT_EQ(num_bytes_sent, sizeof(value));
+    EXPECT_EQ(future.get(), value);
+}
+
+TEST(SocketsTests, ReceiveExactManyBytesViaReactor) {
+    static constexpr auto size = std::size_t{ 1024 * 1024 };
+
+    auto reactor = c2k::Reactor{ 2 };
+
+    auto promise = std::promise<std::vector<std::byte>>{};
+    auto future = promise.get_future();
+    auto const server = c2k::Sockets::create_server(
+            c2k::AddressFamily::Ipv4,
+            0,
+            [&promise](c2k::ClientSocket client) {
+                promise.set_value(client.receive_exact(size).get());
+
+                using namespace std::chrono_literals;
+                std::this_thread::sleep_for(200ms); // keep connection open a bit longer
+            },
+            reactor
+    );
+
+    auto const port = server.local_address().port;
+
+    auto const data = iota(size);
+
+    auto client = c2k::Sockets::create_client(c2k::AddressFamily::Ipv4, localhost, port, reactor);
+    EXPECT_EQ(client.send(data).get(), size);
+    EXPECT_EQ(future.get(), data);
+}
+
+TEST(SocketsTests, ReceiveTimeoutViaReactor) {
+    using namespace std::chrono_literals;
+
+    auto reactor = c2k::Reactor{ 1 };
+
+    auto promise = std::promise<c2k::ClientSocket>{};
+    auto future = promise.get_future();
+    auto const server = c2k::Sockets::create_server(
+            c2k::AddressFamily::Ipv4,
+            0,
+            [&promise](c2k::ClientSocket client) { promise.set_value(std::move(client)); },
+            reactor
+    );
+
+    auto const port = server.local_address().port;
+
+    auto client = c2k::Sockets::create_client(c2k::AddressFamily::Ipv4, localhost, port, reactor);
+    auto client_connection = future.get();
+
+    EXPECT_THROW({ std::ignore = client_connection.receive_exact(1, 100ms).get(); }, c2k::TimeoutError);
+    EXPECT_EQ(client_connection.receive(1, 100ms).get(), std::vector<std::byte>{});
+}
+
+TEST(SocketsTests, SendBorrowedBuffer) {
+    static constexpr auto size = std::size_t{ 1024 };
+
+    auto promise = std::promise<std::vector<std::byte>>{};
+    auto future = promise.get_future();
+    auto const server = c2k::Sockets::create_server(c2k::AddressFamily::Ipv4, 0, [&promise](c2k::ClientSocket client) {
+        promise.set_value(client.receive_exact(size).get());
+
+        using namespace std::chrono_literals;
+        std::this_thread::sleep_for(200ms); // keep connection open a bit longer
+    });
+
+    auto const port = server.local_address().port;
+
+    auto const data = iota(size);
+
+    auto client = c2k::Sockets::create_client(c2k::AddressFamily::Ipv4, localhost, port);
+    // the data is borrowed, so it must stay alive until the returned future is ready
+    auto const num_bytes_sent = client.send(std::span<std::byte const>{ data }).get();
+    EXPECT_EQ(num_bytes_sent, size);
+    EXPECT_EQ(future.get(), data);
+}
+
+TEST(SocketsTests, MessageBufferExtractionAdvancesCursor) {
+    auto buffer = c2k::MessageBuffer{};
+    buffer << std::uint32_t{ 42 } << std::uint16_t{ 7 } << std::uint64_t{ 123456789 };
+    EXPECT_EQ(buffer.size(), 14);
+
+    auto first = std::uint32_t{};
+    buffer >> first;
+    EXPECT_EQ(first, 42);
+    EXPECT_EQ(buffer.size(), 10);
+
+    // consumed bytes stay in place until compact() is called, extraction only advances the cursor
+    buffer.compact();
+    EXPECT_EQ(buffer.size(), 10);
+
+    auto const [second, third] = buffer.try_extract<std::uint16_t, std::uint64_t>().value();
+    EXPECT_EQ(second, 7);
+    EXPECT_EQ(third, 123456789);
+    EXPECT_EQ(buffer.size(), 0);
+
+    // appending after extraction reuses the buffer
+    buffer << std::uint8_t{ 9 };
+    EXPECT_EQ(buffer.size(), 1);
+    EXPECT_EQ(buffer.try_extract<std::uint8_t>().value(), 9);
+}
+
+TEST(SocketsTests, UdpSendAndReceiveDatagramBatch) {
+    static constexpr auto num_datagrams = std::size_t{ 16 };
+    static constexpr auto datagram_size = std::size_t{ 200 };
+
+    auto receiver = c2k::Sockets::create_udp_socket(c2k::AddressFamily::Ipv4, 0);
+    auto const port = receiver.local_address().port;
+    auto sender = c2k::Sockets::create_udp_socket(c2k::AddressFamily::Ipv4, localhost, port);
+
+    auto datagrams = std::vector<std::vector<std::byte>>{};
+    for (auto i = std::size_t{ 0 }; i < num_datagrams; ++i) {
+        datagrams.push_back(iota(datagram_size, static_cast<std::byte>(i)));
+    }
+    EXPECT_EQ(sender.send(std::span{ datagrams }), num_datagrams);
+
+    auto received = std::vector<std::vector<std::byte>>{};
+    while (received.size() < num_datagrams) {
+        auto batch = receiver.receive(num_datagrams - received.size(), datagram_size);
+        ASSERT_FALSE(batch.empty());
+        for (auto& datagram : batch) {
+            received.push_back(std::move(datagram));
+        }
+    }
+    EXPECT_EQ(received, datagrams); // UDP on loopback preserves order in practice
+}
+
+TEST(SocketsTests, MultiAcceptorServerAcceptsAllClients) {
+    static constexpr auto num_clients = 8;
+
+    auto num_accepted = std::atomic_int{ 0 };
+    // clang-format off
+    auto const server = c2k::Sockets::create_server(
+        c2k::AddressFamily::Ipv4,
+        0,
+        [&num_accepted](c2k::ClientSocket client) {
+            ++num_accepted;
+            std::ignore = client.send(std::uint8_t{ 42 }).get();
+        },
+        std::size_t{ 4 }
+    );
+    // clang-format on
+
+    auto const port = server.local_address().port;
+
+    for (auto i = 0; i < num_clients; ++i) {
+        auto client = c2k::Sockets::create_client(c2k::AddressFamily::Ipv4, localhost, port);
+        auto const received = client.receive_exact(1).get();
+        EXPECT_EQ(received.at(0), std::byte{ 42 });
+    }
+    EXPECT_EQ(num_accepted, num_clients);
+}
+
+TEST(SocketsTests, CoroutineSendAndReceive) {
+    static constexpr auto size = std::size_t{ 512 };
+
+    auto const server = c2k::Sockets::create_server(c2k::AddressFamily::Ipv4, 0, [](c2k::ClientSocket client) {
+        // echo the received bytes back to the client
+        auto received = client.receive_exact(size).get();
+        std::ignore = client.send(std::move(received)).get();
+    });
+
+    auto const port = server.local_address().port;
+
+    auto client = c2k::Sockets::create_client(c2k::AddressFamily::Ipv4, localhost, port);
+    auto const data = iota(size);
+
+    auto task = [](c2k::ClientSocket& socket, std::vector<std::byte> payload) -> c2k::Task<std::vector<std::byte>> {
+        auto const num_bytes_sent = co_await socket.async_send(std::move(payload));
+        EXPECT_EQ(num_bytes_sent, size);
+        co_return co_await socket.async_receive_exact(size);
+    }(client, data);
+
+    EXPECT_EQ(std::move(task).get(), data);
+}
+
+TEST(SocketsTests, CoroutineReceiveTimeoutThrowsException) {
+    using namespace std::chrono_literals;
+
+    auto const server = c2k::Sockets::create_server(c2k::AddressFamily::Ipv4, 0, [](c2k::ClientSocket client) {
+        // never send anything, just keep the connection open for a while
+        std::this_thread::sleep_for(300ms);
+        std::ignore = client;
+    });
+
+    auto const port = server.local_address().port;
+
+    auto client = c2k::Sockets::create_client(c2k::AddressFamily::Ipv4, localhost, port);
+
+    auto task = [](c2k::ClientSocket& socket) -> c2k::Task<std::vector<std::byte>> {
+        co_return co_await socket.async_receive_exact(1, 50ms);
+    }(client);
+
+    EXPECT_THROW(std::ignore = std::move(task).get(), c2k::TimeoutError);
+}
+
+TEST(SocketsTests, MessageBufferBulkInsertionAndExtraction) {
+    auto values = std::vector<std::uint64_t>(1000);
+    std::iota(values.begin(), values.end(), std::uint64_t{ 0 });
+
+    auto buffer = c2k::MessageBuffer{};
+    buffer << std::span{ std::as_const(values) };
+    EXPECT_EQ(buffer.size(), values.size() * sizeof(std::uint64_t));
+
+    // the bulk representation is identical to inserting the values one at a time
+    auto reference = c2k::MessageBuffer{};
+    for (auto const value : values) {
+        reference << value;
+    }
+    EXPECT_TRUE(std::ranges::equal(buffer.data(), reference.data()));
+
+    auto extracted = std::vector<std::uint64_t>(values.size());
+    buffer >> std::span{ extracted };
+    EXPECT_EQ(extracted, values);
+    EXPECT_EQ(buffer.size(), 0);
+
+    // extracting from a buffer with too little data must throw and leave the buffer untouched
+    buffer << std::uint64_t{ 1 };
+    EXPECT_THROW(buffer >> std::span{ extracted }, std::runtime_error);
+    EXPECT_EQ(buffer.size(), sizeof(std::uint64_t));
+}
+
+TEST(SocketsTests, MessageBufferCapacityManagement) {
+    auto buffer = c2k::MessageBuffer{};
+    buffer.reserve(64);
+    EXPECT_TRUE(buffer.capacity() >= 64);
+
+    auto const reserved_capacity = buffer.capacity();
+    for (auto i = 0; i < 16; ++i) {
+        buffer << i;
+    }
+    // the insertions fit into the reserved storage and must not have reallocated
+    EXPECT_EQ(buffer.capacity(), reserved_capacity);
+    EXPECT_EQ(buffer.size(), 16 * sizeof(int));
+
+    // clearing discards the contents but keeps the storage for reuse
+    buffer.clear();
+    EXPECT_EQ(buffer.size(), 0);
+    EXPECT_EQ(buffer.capacity(), reserved_capacity);
+
+    buffer << 42;
+    EXPECT_EQ(buffer.try_extract<int>().value(), 42);
+}
+
+TEST(SocketsTests, MessageSchemaRoundTrip) {
+    using Header = c2k::Message<std::uint32_t, std::uint64_t, std::uint16_t>;
+    static_assert(Header::wire_size == sizeof(std::uint32_t) + sizeof(std::uint64_t) + sizeof(std::uint16_t));
+
+    auto const bytes = Header::serialize(42, 123456789, 7);
+
+    // the wire format is identical to serializing the fields through a MessageBuffer
+    auto reference = c2k::MessageBuffer{};
+    reference << std::uint32_t{ 42 } << std::uint64_t{ 123456789 } << std::uint16_t{ 7 };
+    EXPECT_TRUE(std::ranges::equal(bytes, reference.data()));
+
+    auto const values = Header::deserialize(bytes);
+    ASSERT_TRUE(values.has_value());
+    auto const [id, timestamp, flags] = *values;
+    EXPECT_EQ(id, 42);
+    EXPECT_EQ(timestamp, 123456789);
+    EXPECT_EQ(flags, 7);
+
+    // deserialization of a truncated message must fail with its single bounds check
+    EXPECT_FALSE(Header::deserialize(std::span{ bytes }.first(Header::wire_size - 1)).has_value());
+}
+
+TEST(SocketsTests, FramedSendAndReceive) {
+    auto const server = c2k::Sockets::create_server(c2k::AddressFamily::Ipv4, 0, [](c2k::ClientSocket client) {
+        // both frames are sent back-to-back, so a single read can complete both of them
+        auto first = c2k::MessageBuffer{};
+        first << std::uint32_t{ 42 } << std::uint64_t{ 123 };
+        auto second = c2k::MessageBuffer{};
+        second << std::uint16_t{ 7 };
+        std::ignore = client.send_framed(std::move(first));
+        std::ignore = client.send_framed(std::move(second)).get();
+    });
+
+    auto client = c2k::Sockets::create_client(c2k::AddressFamily::Ipv4, localhost, server.local_address().port);
+    auto first = c2k::MessageBuffer{ client.receive_frame().get() };
+    EXPECT_EQ(first.size(), sizeof(std::uint32_t) + sizeof(std::uint64_t));
+    auto const [first_value, second_value] = first.try_extract<std::uint32_t, std::uint64_t>().value();
+    EXPECT_EQ(first_value, 42);
+    EXPECT_EQ(second_value, 123);
+    auto second = c2k::MessageBuffer{ client.receive_frame().get() };
+    EXPECT_EQ(second.try_extract<std::uint16_t>().value(), 7);
+}
+
+TEST(SocketsTests, FramedSendAndReceiveViaReactor) {
+    auto reactor = c2k::Reactor{ 2 };
+
+    auto const server = c2k::Sockets::create_server(
+            c2k::AddressFamily::Ipv4,
+            0,
+            [](c2k::ClientSocket client) {
+                auto frame = c2k::MessageBuffer{};
+                frame << client.receive_frame().get();
+                std::ignore = client.send_framed(std::move(frame)).get();
+            },
+            reactor
+    );
+
+    auto client = c2k::Sockets::create_client(c2k::AddressFamily::Ipv4, localhost, server.local_address().port);
+    auto message = c2k::MessageBuffer{};
+    message << std::uint64_t{ 999 };
+    std::ignore = client.send_framed(std::move(message));
+    auto echoed = c2k::MessageBuffer{ client.receive_frame().get() };
+    EXPECT_EQ(echoed.try_extract<std::uint64_t>().value(), 999);
+}
+
+TEST(SocketsTests, SendFileTransmitsContents) {
+    static constexpr auto file_size = std::size_t{ 256 * 1024 };
+    auto const expected = iota(file_size);
+    auto const path = std::filesystem::temp_directory_path() / "c2k_sockets_send_file_test.bin";
+    {
+        auto file = std::ofstream{ path, std::ios::binary };
+        file.write(reinterpret_cast<char const*>(expected.data()), static_cast<std::streamsize>(expected.size()));
+    }
+
+    auto promise = std::promise<std::vector<std::byte>>{};
+    auto future = promise.get_future();
+    auto const server = c2k::Sockets::create_server(c2k::AddressFamily::Ipv4, 0, [&promise](c2k::ClientSocket client) {
+        promise.set_value(client.receive_exact(file_size, std::chrono::seconds{ 5 }).get());
+    });
+
+    auto client = c2k::Sockets::create_client(c2k::AddressFamily::Ipv4, localhost, server.local_address().port);
+    EXPECT_EQ(client.send_file(path).get(), file_size);
+    EXPECT_EQ(future.get(), expected);
+    std::filesystem::remove(path);
+}
+
+TEST(SocketsTests, SocketOptionsRoundTrip) {
+    auto const options = c2k::SocketOptions{
+        .tcp_no_delay = false,
+        .keep_alive = true,
+        .receive_buffer_size = std::size_t{ 1 } << 20,
+        .send_buffer_size = std::size_t{ 1 } << 20,
+        .max_send_queue_bytes = std::size_t{ 1 } << 16,
+        .send_queue_policy = c2k::SendQueuePolicy::Block,
+        .send_coalescing_window = std::chrono::microseconds{ 50 },
+    };
+
+    auto promise = std::promise<int>{};
+    auto future = promise.get_future();
+    auto const server = c2k::Sockets::create_server(
+            c2k::AddressFamily::Ipv4,
+            0,
+            [&promise](c2k::ClientSocket client) {
+                auto buffer = c2k::MessageBuffer{};
+                buffer << client.receive_exact(sizeof(int)).get();
+                promise.set_value(buffer.try_extract<int>().value());
+            },
+            options
+    );
+
+    static constexpr auto value = 42;
+    auto client = c2k::Sockets::create_client(c2k::AddressFamily::Ipv4, localhost, server.local_address().port, options);
+    std::ignore = client.send(value).get();
+    EXPECT_EQ(future.get(), value);
+}
+
+TEST(SocketsTests, StreamingOnDataCallback) {
+    static constexpr auto num_bytes = std::size_t{ 64 * 1024 };
+
+    auto const server = c2k::Sockets::create_server(c2k::AddressFamily::Ipv4, 0, [](c2k::ClientSocket client) {
+        auto data = std::vector<std::byte>{};
+        data.reserve(num_bytes);
+        for (auto i = std::size_t{ 0 }; i < num_bytes; ++i) {
+            data.push_back(static_cast<std::byte>(i));
+        }
+        std::ignore = client.send(std::move(data)).get();
+    });
+
+    auto client = c2k::Sockets::create_client(c2k::AddressFamily::Ipv4, localhost, server.local_address().port);
+    auto received = std::vector<std::byte>{};
+    auto promise = std::promise<std::vector<std::byte>>{};
+    auto future = promise.get_future();
+    client.set_on_data([&received, &promise](std::span<std::byte const> const chunk) {
+        received.insert(received.end(), chunk.begin(), chunk.end());
+        if (received.size() >= num_bytes) {
+            promise.set_value(std::move(received));
+        }
+    });
+
+    auto const result = future.get();
+    client.set_on_data({});
+    ASSERT_EQ(result.size(), num_bytes);
+    for (auto i = std::size_t{ 0 }; i < num_bytes; ++i) {
+        ASSERT_EQ(result[i], static_cast<std::byte>(i));
+    }
+}
+
+TEST(SocketsTests, StatsReflectTraffic) {
+    static constexpr auto value = std::uint32_t{ 42 };
+    auto const server = c2k::Sockets::create_server(c2k::AddressFamily::Ipv4, 0, [](c2k::ClientSocket client) {
+        std::ignore = client.send(client.receive_exact(sizeof(value)).get()).get();
+    });
+
+    auto client = c2k::Sockets::create_client(c2k::AddressFamily::Ipv4, localhost, server.local_address().port);
+    std::ignore = client.send(value).get();
+    auto const received = client.receive_exact(sizeof(value)).get();
+    EXPECT_EQ(received.size(), sizeof(value));
+
+    auto const client_stats = client.stats();
+    EXPECT_EQ(client_stats.num_bytes_sent, sizeof(value));
+    EXPECT_EQ(client_stats.num_bytes_received, sizeof(value));
+    EXPECT_TRUE(client_stats.num_send_syscalls >= 1);
+    EXPECT_TRUE(client_stats.num_receive_syscalls >= 1);
+    EXPECT_EQ(client_stats.num_pending_send_tasks, 0);
+    EXPECT_EQ(client_stats.num_pending_receive_tasks, 0);
+
+    EXPECT_EQ(server.stats().num_connections_accepted, 1);
+}
+
+TEST(SocketsTests, ConcurrentConnectCallbackDispatch) {
+    using namespace std::chrono_literals;
+
+    auto second_connection_dispatched = std::promise<void>{};
+    auto second_connection_dispatched_future = second_connection_dispatched.get_future();
+    auto first_handler_unblocked = std::promise<bool>{};
+    auto first_handler_unblocked_future = first_handler_unblocked.get_future();
+    auto num_invocations = std::atomic<int>{ 0 };
+
+    auto const options = c2k::SocketOptions{ .num_connect_callback_threads = 2 };
+    auto const server = c2k::Sockets::create_server(
+            c2k::AddressFamily::Ipv4,
+            0,
+            [&](c2k::ClientSocket) {
+                switch (num_invocations.fetch_add(1)) {
+                    case 0:
+                        // with a single dispatch thread this would deadlock, since the second
+                        // connection could only be dispatched after this handler returned
+                        first_handler_unblocked.set_value(
+                                second_connection_dispatched_future.wait_for(5s) == std::future_status::ready
+                        );
+                        break;
+                    case 1:
+                        second_connection_dispatched.set_value();
+                        break;
+                    default:
+                        break;
+                }
+            },
+            options
+    );
+
+    auto const first_client =
+            c2k::Sockets::create_client(c2k::AddressFamily::Ipv4, localhost, server.local_address().port);
+    auto const second_client =
+            c2k::Sockets::create_client(c2k::AddressFamily::Ipv4, localhost, server.local_address().port);
+    EXPECT_TRUE(first_handler_unblocked_future.get());
+}
+
+TEST(SocketsTests, AsyncConnectEstablishesConnection) {
+    using namespace std::chrono_literals;
+    static constexpr auto value = 42;
+
+    auto const server = c2k::Sockets::create_server(c2k::AddressFamily::Ipv4, 0, [](c2k::ClientSocket client) {
+        std::ignore = client.send(value).get();
+    });
+
+    auto client =
+            c2k::Sockets::create_client_async(c2k::AddressFamily::Ipv4, localhost, server.local_address().port, 5s)
+                    .get();
+    auto buffer = c2k::MessageBuffer{};
+    buffer << client.receive_exact(sizeof(value), 5s).get();
+    EXPECT_EQ(buffer.try_extract<int>().value(), value);
+}
+
+TEST(SocketsTests, UnixDomainSocketRoundTrip) {
+    auto const path = std::filesystem::temp_directory_path() / "c2k_sockets_unix_test.sock";
+
+    auto promise = std::promise<int>{};
+    auto future = promise.get_future();
+    auto server = c2k::Sockets::create_server(path, [&promise](c2k::ClientSocket client) {
+        auto buffer = c2k::MessageBuffer{};
+        buffer << client.receive_exact(sizeof(int)).get();
+        promise.set_value(buffer.try_extract<int>().value());
+    });
+
+    static constexpr auto value = 42;
+    auto client = c2k::Sockets::create_client(path);
+    EXPECT_EQ(client.remote_address().family, c2k::AddressFamily::Unix);
+    auto const num_bytes_sent = client.send(value).get();
+    EXPECT_EQ(num_bytes_sent, sizeof(value));
+    EXPECT_EQ(future.get(), value);
+
+    // stopping the server removes the socket file again
+    server.stop();
+    EXPECT_FALSE(std::filesystem::exists(path));
+}
+
+TEST(SocketsTests, CloseReturnsImmediatelyAndReaperClosesHandle) {
+    using namespace std::chrono_literals;
+
+    auto promise = std::promise<void>{};
+    auto future = promise.get_future();
+    auto const server = c2k::Sockets::create_server(c2k::AddressFamily::Ipv4, 0, [&promise](c2k::ClientSocket client) {
+        try {
+            std::ignore = client.receive_exact(1, 5s).get();
+        } catch (...) {
+            // the peer closing the connection surfaces as a ReadError
+        }
+        promise.set_value();
+    });
+
+    auto client = c2k::Sockets::create_client(c2k::AddressFamily::Ipv4, localhost, server.local_address().port);
+    EXPECT_TRUE(client.is_connected());
+    client.close();
+    // the socket stays queryable after close() even though the background reaper may still
+    // be joining its threads
+    EXPECT_FALSE(client.is_connected());
+    // the reaper closes the OS handle, which the server observes as a disconnect
+    EXPECT_EQ(future.wait_for(5s), std::future_status::ready);
+}